@@ -0,0 +1,39 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    BENCH_config.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : BENCH
+ *
+ */
+
+#ifndef BENCH_CONFIG_H_
+#define BENCH_CONFIG_H_
+
+/*Set Benchmark Mode
+ * choose between
+ * 1. DISABLE
+ * 2. BENCH_MENU  (the hidden main menu key BENCH_MENU_KEY runs it)
+ * 3. BENCH_BOOT  (runs once at start up, the hidden key works too)
+ */
+#define BENCH_MODE                          DISABLE
+
+/*Set the main menu key that starts the benchmark*/
+#define BENCH_MENU_KEY                      '9'
+
+/*Set System Frequency*/
+#define BENCH_SYSTEM_FREQUENCY              8000000UL
+
+/*Set how many bytes each throughput test sends (1 to 4000)*/
+#define BENCH_BYTES                         256
+
+/*Set how many single bytes the round trip test sends (TXD looped back to RXD, or the host echoing)*/
+#define BENCH_ROUND_TRIPS                   64
+
+/*Set how many milliseconds to wait for a byte to come back*/
+#define BENCH_REPLY_TIMEOUT                 20
+
+/*Set how many milliseconds the echo test echoes the host*/
+#define BENCH_ECHO_TIME                     10000
+
+#endif /* BENCH_CONFIG_H_ */
@@ -0,0 +1,25 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    BENCH_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : BENCH
+ *
+ */
+
+#ifndef BENCH_INTERFACE_H_
+#define BENCH_INTERFACE_H_
+
+#define BENCH_MENU                          1
+#define BENCH_BOOT                          2
+
+/*
+ * Runs the USART tests and reports one line per test over the USART :
+ *  "TX ring", "TX synch", "TX asynch" : cycles and bytes per second for BENCH_BYTES bytes
+ *  "Round trip"                       : min/avg/max cycles per byte and jitter (max - min)
+ *  "Echo"                             : bytes echoed back to the host in BENCH_ECHO_TIME
+ *  "RX errors"                        : FE, DOR, PE and bytes dropped by a full RX ring
+ */
+void BENCH_vRun                             (void                                                                          );
+
+#endif /* BENCH_INTERFACE_H_ */
@@ -0,0 +1,24 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    BENCH_private.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : BENCH
+ *
+ */
+
+#ifndef BENCH_PRIVATE_H_
+#define BENCH_PRIVATE_H_
+
+/*Milliseconds for the last queued bytes to leave the shift register before UDR is written directly*/
+#define BENCH_SETTLE_TIME                   3
+
+/*Byte sent by the throughput tests, 0x55 toggles every bit*/
+#define BENCH_PATTERN                       'U'
+
+/*Pattern bytes kept in RAM, the string tests send them over and over (at most 255 for USART_u8SendStringAsynch)*/
+#define BENCH_CHUNK_SIZE                    32
+
+#define BENCH_CYCLES_PER_US                 ((BENCH_SYSTEM_FREQUENCY) / 1000000UL)
+
+#endif /* BENCH_PRIVATE_H_ */
@@ -0,0 +1,357 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    BENCH_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : BENCH
+ *
+ */
+
+#include <avr/pgmspace.h>
+
+#include "../STD_TYPES.h"
+#include "../STD_MACROS.h"
+
+#include "BENCH_interface.h"
+#include "BENCH_private.h"
+#include "BENCH_config.h"
+
+#include "../../MCAL_Layer/USART/USART_interface.h"
+#include "../../MCAL_Layer/TIMER/TIMER_interface.h"
+
+#if BENCH_MODE != DISABLE
+
+#if (BENCH_BYTES < 1) || (BENCH_BYTES > 4000)
+#error "Wrong BENCH_BYTES config"
+#endif
+
+#if (BENCH_CHUNK_SIZE < 1) || (BENCH_CHUNK_SIZE > 255)
+#error "Wrong BENCH_CHUNK_SIZE config"
+#endif
+
+/*Pattern sent by the string tests, '\0' terminated for the string functions*/
+static u8 BENCH_au8Chunk[BENCH_CHUNK_SIZE + 1];
+
+/*Cycles taken by TIMER_u32GetCycles itself, taken off every measurement*/
+static u32 BENCH_u32Overhead;
+
+/*Set by the notification of USART_u8SendStringAsynch*/
+static volatile u8 BENCH_u8AsynchDone;
+static volatile u32 BENCH_u32AsynchEnd;
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sends a report string kept in flash
+ * Parameters :
+ *            => Copy_pu8String : null terminated string in flash (PSTR)
+ * return     :  Nothing
+ */
+static void BENCH_vSend_P(const u8 *Copy_pu8String)
+{
+  USART_u8SendStringSynch_P(Copy_pu8String);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function gives the pattern string for the next piece of a string test
+ * Parameters :
+ *            => Copy_pu16Left : bytes the test still has to send, lowered by the length of the piece
+ * return     :  '\0' terminated pattern of up to BENCH_CHUNK_SIZE bytes
+ */
+static u8 *BENCH_pu8NextChunk(u16 *Copy_pu16Left)
+{
+  u8 Local_u8Length = (*Copy_pu16Left > BENCH_CHUNK_SIZE) ? BENCH_CHUNK_SIZE : (u8)*Copy_pu16Left;
+
+  *Copy_pu16Left -= Local_u8Length;
+
+  /*A shorter piece is the tail of the pattern*/
+  return &BENCH_au8Chunk[BENCH_CHUNK_SIZE - Local_u8Length];
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sends "<name>: <cycles> cyc <rate> B/s" for a throughput test
+ * Parameters :
+ *            => Copy_pu8Name    : test name, in flash
+ *            => Copy_u32Cycles  : cycles taken to send BENCH_BYTES bytes
+ * return     :  Nothing
+ */
+static void BENCH_vReportRate(const u8 *Copy_pu8Name, u32 Copy_u32Cycles)
+{
+  u32 Local_u32Us = Copy_u32Cycles / BENCH_CYCLES_PER_US;
+
+  BENCH_vSend_P(Copy_pu8Name);
+  BENCH_vSend_P((const u8 *)PSTR(": "));
+  USART_u8SendNumber(Copy_u32Cycles);
+  BENCH_vSend_P((const u8 *)PSTR(" cyc "));
+  USART_u8SendNumber((Local_u32Us != 0) ? (((u32)BENCH_BYTES * 1000000UL) / Local_u32Us) : 0);
+  BENCH_vSend_P((const u8 *)PSTR(" B/s\r\n"));
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function lets the TX ring buffer and the shift register run empty and drops received bytes
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void BENCH_vSettle(void)
+{
+  u32 Local_u32Deadline;
+  u8 Local_u8Byte;
+
+  USART_vFlushTx();
+  Local_u32Deadline = TIMER_u32Deadline(BENCH_SETTLE_TIME);
+  while (TIMER_u8IsExpired(Local_u32Deadline) == 0);
+
+  while (USART_u8GetChar(&Local_u8Byte) == OK);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function is the TX complete notification of the asynch test
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void BENCH_vAsynchDone(void)
+{
+  BENCH_u32AsynchEnd = TIMER_u32GetCycles();
+  BENCH_u8AsynchDone = 1;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function measures the TX ring buffer, USART_u8SendStringSynch and USART_u8SendStringAsynch
+ *              (the string functions send BENCH_BYTES in pieces of BENCH_CHUNK_SIZE, so no BENCH_BYTES buffer is needed)
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void BENCH_vThroughput(void)
+{
+  u32 Local_u32Start;
+  u32 Local_u32Cycles;
+  u32 Local_u32Deadline;
+  u16 Local_u16Index;
+  u16 Local_u16Left;
+
+  /*TX ring buffer, byte by byte until the last one is handed to UDR*/
+  BENCH_vSettle();
+  Local_u32Start = TIMER_u32GetCycles();
+  for (Local_u16Index = 0; Local_u16Index < BENCH_BYTES; Local_u16Index++)
+  {
+    while (USART_u8PutChar(BENCH_PATTERN) == BUSY_STATE);
+  }
+  USART_vFlushTx();
+  Local_u32Cycles = TIMER_u32GetCycles() - Local_u32Start - BENCH_u32Overhead;
+  BENCH_vSettle();
+  BENCH_vSend_P((const u8 *)PSTR("\r\n"));
+  BENCH_vReportRate((const u8 *)PSTR("TX ring"), Local_u32Cycles);
+
+  /*USART_u8SendStringSynch*/
+  BENCH_vSettle();
+  Local_u16Left = BENCH_BYTES;
+  Local_u32Start = TIMER_u32GetCycles();
+  while (Local_u16Left != 0)
+  {
+    USART_u8SendStringSynch(BENCH_pu8NextChunk(&Local_u16Left));
+  }
+  USART_vFlushTx();
+  Local_u32Cycles = TIMER_u32GetCycles() - Local_u32Start - BENCH_u32Overhead;
+  BENCH_vSettle();
+  BENCH_vSend_P((const u8 *)PSTR("\r\n"));
+  BENCH_vReportRate((const u8 *)PSTR("TX synch"), Local_u32Cycles);
+
+  /*USART_u8SendStringAsynch, ends in the UDR empty ISR once the last byte is handed to UDR,
+    each piece starts as soon as the one before it is done*/
+  BENCH_vSettle();
+  Local_u16Left = BENCH_BYTES;
+  Local_u32Deadline = TIMER_u32Deadline(BENCH_REPLY_TIMEOUT + ((u32)BENCH_BYTES * 2));
+  Local_u32Start = TIMER_u32GetCycles();
+  while (Local_u16Left != 0)
+  {
+    BENCH_u8AsynchDone = 0;
+    if (USART_u8SendStringAsynch(BENCH_pu8NextChunk(&Local_u16Left), BENCH_vAsynchDone) != OK)
+    {
+      break;
+    }
+    while ((BENCH_u8AsynchDone == 0) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
+    if (BENCH_u8AsynchDone == 0)
+    {
+      break;
+    }
+  }
+  BENCH_vSettle();
+  BENCH_vSend_P((const u8 *)PSTR("\r\n"));
+  if (BENCH_u8AsynchDone)
+  {
+    BENCH_vReportRate((const u8 *)PSTR("TX asynch"), BENCH_u32AsynchEnd - Local_u32Start - BENCH_u32Overhead);
+  }
+  else
+  {
+    BENCH_vSend_P((const u8 *)PSTR("TX asynch: timeout\r\n"));
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function times single bytes from the TX ring buffer until they are back in the RX ring buffer
+ *              (UDR empty ISR, the frame on the wire, the RX complete ISR and this loop)
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void BENCH_vRoundTrip(void)
+{
+  u32 Local_u32Min = 0xFFFFFFFFUL;
+  u32 Local_u32Max = 0;
+  u32 Local_u32Sum = 0;
+  u32 Local_u32Start;
+  u32 Local_u32Cycles;
+  u32 Local_u32Deadline;
+  u16 Local_u16Count = 0;
+  u16 Local_u16Lost = 0;
+  u16 Local_u16Index;
+  u8 Local_u8Sent;
+  u8 Local_u8Byte;
+  u8 Local_u8ErrorState;
+
+  BENCH_vSettle();
+
+  for (Local_u16Index = 0; Local_u16Index < BENCH_ROUND_TRIPS; Local_u16Index++)
+  {
+    Local_u8Sent = 'A' + (Local_u16Index % 26);
+    Local_u32Deadline = TIMER_u32Deadline(BENCH_REPLY_TIMEOUT);
+
+    Local_u32Start = TIMER_u32GetCycles();
+    USART_u8PutChar(Local_u8Sent);
+    while (((Local_u8ErrorState = USART_u8GetChar(&Local_u8Byte)) != OK) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
+    Local_u32Cycles = TIMER_u32GetCycles() - Local_u32Start - BENCH_u32Overhead;
+
+    if ((Local_u8ErrorState == OK) && (Local_u8Byte == Local_u8Sent))
+    {
+      Local_u16Count++;
+      Local_u32Sum += Local_u32Cycles;
+      if (Local_u32Cycles < Local_u32Min)
+      {
+        Local_u32Min = Local_u32Cycles;
+      }
+      if (Local_u32Cycles > Local_u32Max)
+      {
+        Local_u32Max = Local_u32Cycles;
+      }
+    }
+    else
+    {
+      Local_u16Lost++;
+    }
+  }
+
+  BENCH_vSettle();
+
+  if (Local_u16Count == 0)
+  {
+    BENCH_vSend_P((const u8 *)PSTR("Round trip: no loopback or echo\r\n"));
+    return;
+  }
+
+  BENCH_vSend_P((const u8 *)PSTR("Round trip: min "));
+  USART_u8SendNumber(Local_u32Min);
+  BENCH_vSend_P((const u8 *)PSTR(" avg "));
+  USART_u8SendNumber(Local_u32Sum / Local_u16Count);
+  BENCH_vSend_P((const u8 *)PSTR(" max "));
+  USART_u8SendNumber(Local_u32Max);
+  BENCH_vSend_P((const u8 *)PSTR(" jitter "));
+  USART_u8SendNumber(Local_u32Max - Local_u32Min);
+  BENCH_vSend_P((const u8 *)PSTR(" cyc lost "));
+  USART_u8SendNumber(Local_u16Lost);
+  BENCH_vSend_P((const u8 *)PSTR("\r\n"));
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function echoes every received byte for BENCH_ECHO_TIME, the host measures the link
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void BENCH_vEcho(void)
+{
+  u32 Local_u32Deadline;
+  u32 Local_u32Bytes = 0;
+  u8 Local_u8Byte;
+
+  BENCH_vSend_P((const u8 *)PSTR("Echo: start\r\n"));
+  BENCH_vSettle();
+
+  Local_u32Deadline = TIMER_u32Deadline(BENCH_ECHO_TIME);
+  while (TIMER_u8IsExpired(Local_u32Deadline) == 0)
+  {
+    if (USART_u8GetChar(&Local_u8Byte) == OK)
+    {
+      while (USART_u8PutChar(Local_u8Byte) == BUSY_STATE);
+      Local_u32Bytes++;
+    }
+  }
+
+  BENCH_vSettle();
+  BENCH_vSend_P((const u8 *)PSTR("\r\nEcho: "));
+  USART_u8SendNumber(Local_u32Bytes);
+  BENCH_vSend_P((const u8 *)PSTR(" B "));
+  USART_u8SendNumber(Local_u32Bytes * 1000UL / BENCH_ECHO_TIME);
+  BENCH_vSend_P((const u8 *)PSTR(" B/s\r\n"));
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function runs every test and reports the results and the receive errors over the USART
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void BENCH_vRun(void)
+{
+  USART_Errors_t Local_Errors;
+  u32 Local_u32Start;
+  u16 Local_u16Index;
+
+  for (Local_u16Index = 0; Local_u16Index < BENCH_CHUNK_SIZE; Local_u16Index++)
+  {
+    BENCH_au8Chunk[Local_u16Index] = BENCH_PATTERN;
+  }
+  BENCH_au8Chunk[BENCH_CHUNK_SIZE] = '\0';
+
+  TIMER_vCycleStart();
+  Local_u32Start = TIMER_u32GetCycles();
+  BENCH_u32Overhead = TIMER_u32GetCycles() - Local_u32Start;
+
+  USART_vGetErrors(NULL, 1);
+
+  BENCH_vSend_P((const u8 *)PSTR("\r\nBenchmark, cycles at "));
+  USART_u8SendNumber(BENCH_SYSTEM_FREQUENCY);
+  BENCH_vSend_P((const u8 *)PSTR(" Hz\r\n"));
+
+  BENCH_vThroughput();
+  BENCH_vRoundTrip();
+  BENCH_vEcho();
+
+  USART_vGetErrors(&Local_Errors, 0);
+  BENCH_vSend_P((const u8 *)PSTR("RX errors: FE "));
+  USART_u8SendNumber(Local_Errors.Frame);
+  BENCH_vSend_P((const u8 *)PSTR(" DOR "));
+  USART_u8SendNumber(Local_Errors.Overrun);
+  BENCH_vSend_P((const u8 *)PSTR(" PE "));
+  USART_u8SendNumber(Local_Errors.Parity);
+  BENCH_vSend_P((const u8 *)PSTR(" dropped "));
+  USART_u8SendNumber(Local_Errors.Dropped);
+  BENCH_vSend_P((const u8 *)PSTR("\r\n"));
+
+  USART_vFlushTx();
+  TIMER_vCycleStop();
+}
+
+#endif /* BENCH_MODE != DISABLE */
@@ -12,18 +12,25 @@
 #include "STD_MACROS.h"
 
 #include "../MCAL_Layer/DIO/DIO_interface.h"
+#include "../MCAL_Layer/GIE/GIE_interface.h"
 #include "../MCAL_Layer/EEPROM/EEPROM_interface.h"
 #include "../MCAL_Layer/USART/USART_interface.h"
+#include "../MCAL_Layer/TIMER/TIMER_interface.h"
 
 #include "../HAL_Layer/CLCD/CLCD_interface.h"
 
 #include "SECURITY/SECURITY_interface.h"
+#include "MSG/MSG_interface.h"
+#include "HOST/HOST_interface.h"
+#include "BENCH/BENCH_interface.h"
+#include "BENCH/BENCH_config.h"
 
 /* External Variables Declaration */
 extern volatile u8 Error_State;  // Stores the current error state of operations
 extern volatile u8 User_Count;   // Tracks the total number of registered users
 extern volatile u8 Is_Admin;     // Flag indicating if current user is admin
 extern volatile u8 Current_User; // Index of the currently logged in user
+extern volatile u8 Bad_Records;  // Number of user records that failed their CRC at boot
 
 /* Constants */
 #define INPUT_TIMEOUT_MS 30000 // 30 seconds timeout for user input
@@ -53,9 +60,9 @@ u8 Wait_For_Input(u8 *input, u16 timeout_ms);
 
 /**
  * @brief Displays error message on LCD
- * @param message Error message to display
+ * @param message Error message number (MSG_...)
  */
-void Display_Error(const u8 *message);
+void Display_Error(u8 message);
 
 /**
  * @brief Displays main menu with system status
@@ -77,7 +84,9 @@ void Display_Menu(void);
 int main(void)
 {
   // Initialize hardware components
+  TIMER_vInit(); // 1 ms tick used by every timeout
   USART_vInit();
+  GIE_vEnable(); // EEPROM writes are queued and drained by the EEPROM ready interrupt
   EEPROM_vInit();
   CLCD_vInit();
 
@@ -85,17 +94,29 @@ int main(void)
   Display_Welcome();
   Display_Init_Status();
 
+#if BENCH_MODE == BENCH_BOOT
+  BENCH_vRun();
+#endif
+
   u8 choice;
 
   // Main program loop
   while (1)
   {
+    HOST_u8SetBusy(0); // Back at the main menu, the host may change the user table
     Display_Menu();
 
     // Wait for user input with timeout
     if (!Wait_For_Input(&choice, INPUT_TIMEOUT_MS))
     {
-      Display_Error((u8 *)"Input Timeout!");
+      Display_Error(MSG_INPUT_TIMEOUT);
+      continue;
+    }
+
+    // The host is restoring the user table, no session until it commits or times out
+    if (HOST_u8SetBusy(1) != OK)
+    {
+      Display_Error(MSG_RESTORE_RUNNING);
       continue;
     }
 
@@ -121,9 +142,9 @@ int main(void)
       if (User_Count >= MAX_USERS)
       {
         CLCD_vClearScreen();
-        CLCD_vSendString((u8 *)"EEPROM Full!");
+        MSG_vShow(MSG_EEPROM_FULL);
         CLCD_vSetPosition(2, 1);
-        CLCD_vSendString((u8 *)"Max Users: ");
+        MSG_vShow(MSG_MAX_USERS);
         CLCD_vSendIntNumber(MAX_USERS);
         _delay_ms(DISPLAY_DELAY_MS);
         continue;
@@ -137,13 +158,22 @@ int main(void)
       // Show remaining capacity
       CLCD_vClearScreen();
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Space Left: ");
+      MSG_vShow(MSG_SPACE_LEFT);
       CLCD_vSendIntNumber(MAX_USERS - User_Count);
       _delay_ms(DISPLAY_DELAY_MS);
     }
+#if BENCH_MODE != DISABLE
+    else if (choice == BENCH_MENU_KEY)
+    {
+      // Hidden entry, results go out over the USART
+      CLCD_vClearScreen();
+      MSG_vShow(MSG_BENCHMARK);
+      BENCH_vRun();
+    }
+#endif
     else
     {
-      Display_Error((u8 *)"Invalid Choice!");
+      Display_Error(MSG_INVALID_CHOICE);
     }
   }
 
@@ -153,63 +183,65 @@ int main(void)
 void Display_Welcome(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"     Welcome to");
+  MSG_vShow(MSG_WELCOME_TO);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"   Advanced Safe");
+  MSG_vShow(MSG_ADVANCED_SAFE);
   _delay_ms(DISPLAY_DELAY_MS);
 
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Developed by:");
+  MSG_vShow(MSG_DEVELOPED_BY);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"Abdallah Shehawey");
+  MSG_vShow(MSG_AUTHOR);
   _delay_ms(DISPLAY_DELAY_MS);
 }
 
 void Display_Init_Status(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Initializing");
+  MSG_vShow(MSG_INITIALIZING);
   CLCD_vSetPosition(2, 1);
 
   // Initialize and verify LCD
-  CLCD_vSendString((u8 *)"LCD...");
-  CLCD_vSendString((u8 *)"OK");
+  MSG_vShow(MSG_INIT_LCD);
+  MSG_vShow(MSG_OK);
   _delay_ms(500);
 
   // Initialize and verify USART
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"USART...");
+  MSG_vShow(MSG_INIT_USART);
   USART_vInit();
-  CLCD_vSendString((u8 *)"OK");
+  MSG_vShow(MSG_OK);
   _delay_ms(500);
 
   // Initialize and verify EEPROM
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"EEPROM...");
+  MSG_vShow(MSG_INIT_EEPROM);
   EEPROM_vInit();
-  CLCD_vSendString((u8 *)"OK");
+  MSG_vShow(MSG_OK);
   _delay_ms(500);
 }
 
 /**
  * @brief Implementation of input wait with timeout
- * @details Polls for USART input until timeout occurs
+ * @details Checks the USART receive buffer until the timer tick passes the deadline,
+ *          host protocol frames arriving meanwhile are handled and not returned as input
  * @param input Pointer to store received character
  * @param timeout_ms Maximum time to wait in milliseconds
  * @return 1 if input received, 0 if timeout occurred
  */
 u8 Wait_For_Input(u8 *input, u16 timeout_ms)
 {
-  u16 elapsed = 0;
-  while (elapsed < timeout_ms)
+  u32 deadline = TIMER_u32Deadline(timeout_ms);
+  while (!TIMER_u8IsExpired(deadline))
   {
-    Error_State = USART_u8ReceiveData(input);
-    if (Error_State == OK)
+    if (HOST_u8Poll() == NOK)
     {
-      return 1; // Input received successfully
+      Error_State = USART_u8GetChar(input);
+      if (Error_State == OK)
+      {
+        return 1; // Input received successfully
+      }
     }
-    _delay_ms(1);
-    elapsed++;
   }
   return 0; // Timeout occurred
 }
@@ -217,14 +249,14 @@ u8 Wait_For_Input(u8 *input, u16 timeout_ms)
 /**
  * @brief Implementation of error message display
  * @details Clears screen, shows error header and message
- * @param message Error message to display
+ * @param message Error message number (MSG_...)
  */
-void Display_Error(const u8 *message)
+void Display_Error(u8 message)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Error:");
+  MSG_vShow(MSG_ERROR);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)message);
+  MSG_vShow(message);
   _delay_ms(DISPLAY_DELAY_MS);
 }
 
@@ -234,29 +266,38 @@ void Display_Error(const u8 *message)
  *         - Sign in option
  *         - New user registration option
  *         - Current user count and maximum capacity
+ *         - Number of corrupted user records, if any
  *         - System status and remaining tries
  */
 void Display_Menu(void)
 {
+  /* Redrawn after every action, the frame sends only the fields that changed */
+  CLCD_vBeginFrame();
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"1:Sign In");
+  MSG_vShow(MSG_MENU_SIGN_IN);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"2:New User");
+  MSG_vShow(MSG_MENU_NEW_USER);
   CLCD_vSetPosition(3, 1);
-  CLCD_vSendString((u8 *)"Users:");
+  MSG_vShow(MSG_USERS);
   CLCD_vSendIntNumber(User_Count);
-  CLCD_vSendString((u8 *)"/");
+  CLCD_vSendData('/');
   CLCD_vSendIntNumber(MAX_USERS);
+  if (Bad_Records > 0)
+  {
+    MSG_vShow(MSG_BAD);
+    CLCD_vSendIntNumber(Bad_Records);
+  }
 
   // Show system status
   CLCD_vSetPosition(4, 1);
   if (Tries < Tries_Max)
   {
-    CLCD_vSendString((u8 *)"Tries Left: ");
+    MSG_vShow(MSG_TRIES_LEFT);
     CLCD_vSendIntNumber(Tries);
   }
   else
   {
-    CLCD_vSendString((u8 *)"System Ready");
+    MSG_vShow(MSG_SYSTEM_READY);
   }
+  CLCD_vEndFrame();
 }
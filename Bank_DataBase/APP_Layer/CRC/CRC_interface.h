@@ -0,0 +1,18 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    CRC_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : LIB
+ *  SWC    : CRC
+ *
+ */
+
+#ifndef CRC_INTERFACE_H_
+#define CRC_INTERFACE_H_
+
+/* CRC-8 (poly 0x07, no reflection, no final xor), check value of "123456789" is 0xF4 */
+#define CRC8_INIT                           0x00
+
+u8   CRC_u8Calc8                            (u8 Copy_u8Crc, const u8 *Copy_pu8Data, u16 Copy_u16Size                       );
+
+#endif /* CRC_INTERFACE_H_ */
@@ -0,0 +1,41 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    CRC_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : LIB
+ *  SWC    : CRC
+ *
+ */
+
+#include "../STD_TYPES.h"
+#include "../STD_MACROS.h"
+
+#include "CRC_interface.h"
+
+/*CRC-8 of every nibble value shifted through the polynomial, 16 bytes instead of a 256 byte table*/
+static const u8 CRC_Au8Nibble8[16] =
+{
+  0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+  0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function update a CRC-8 with a buffer, two table lookups per byte
+ * Parameters :
+ *      => Copy_u8Crc     --> CRC8_INIT to start, or the result of the previous call to continue
+ *      => Copy_pu8Data   --> data to add
+ *      => Copy_u16Size   --> number of bytes
+ * return     :  updated CRC
+ */
+u8 CRC_u8Calc8(u8 Copy_u8Crc, const u8 *Copy_pu8Data, u16 Copy_u16Size)
+{
+  for (u16 Local_u16Index = 0; Local_u16Index < Copy_u16Size; Local_u16Index++)
+  {
+    Copy_u8Crc ^= Copy_pu8Data[Local_u16Index];
+    Copy_u8Crc = (u8)(Copy_u8Crc << 4) ^ CRC_Au8Nibble8[Copy_u8Crc >> 4];
+    Copy_u8Crc = (u8)(Copy_u8Crc << 4) ^ CRC_Au8Nibble8[Copy_u8Crc >> 4];
+  }
+  return Copy_u8Crc;
+}
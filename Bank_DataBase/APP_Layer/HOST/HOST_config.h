@@ -0,0 +1,25 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    HOST_config.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : HOST
+ *
+ */
+
+#ifndef HOST_CONFIG_H_
+#define HOST_CONFIG_H_
+
+/*Set the largest payload of a frame in both directions (1 to 255)*/
+#define HOST_MAX_PAYLOAD                    64
+
+/*Set how many milliseconds a frame may stall between two bytes before it is dropped*/
+#define HOST_FRAME_TIMEOUT                  100
+
+/*Set how many milliseconds after the last HOST_CMD_IMPORT the user table is reloaded without a HOST_CMD_COMMIT*/
+#define HOST_RESTORE_TIMEOUT                5000
+
+/*Set how many milliseconds logins are refused after a wrong admin password*/
+#define HOST_LOGIN_DELAY                    1000
+
+#endif /* HOST_CONFIG_H_ */
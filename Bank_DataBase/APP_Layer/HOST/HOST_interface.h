@@ -0,0 +1,52 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    HOST_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : HOST
+ *
+ */
+
+#ifndef HOST_INTERFACE_H_
+#define HOST_INTERFACE_H_
+
+/*
+ * Frame : [HOST_DLE][HOST_STX][LEN][CMD][PAYLOAD, LEN bytes][CRC-8 of LEN, CMD and PAYLOAD]
+ * Reply : same layout, CMD | HOST_REPLY_FLAG and the payload starts with a status byte
+ * After HOST_STX the bytes HOST_DLE, USART_XON and USART_XOFF are sent as [HOST_DLE][byte ^ HOST_ESCAPE_XOR],
+ * so [HOST_DLE][HOST_STX] only ever starts a frame and USART_FLOW_XON_XOFF never takes a frame byte for flow control.
+ * Both are control keys the line editor drops, so typed text never opens a frame
+ */
+#define HOST_DLE                            0x10
+#define HOST_STX                            0x02
+#define HOST_ESCAPE_XOR                     0x20
+#define HOST_REPLY_FLAG                     0x80
+#define HOST_PROTOCOL_VERSION               0x01
+
+/*Commands ("admin" ones need HOST_CMD_LOGIN first)*/
+#define HOST_CMD_PING                       0x01    // -> [version]
+#define HOST_CMD_COUNTERS                   0x02    // -> [users][max users][tries][bad records]
+#define HOST_CMD_LOGIN                      0x03    // [admin password]
+#define HOST_CMD_LOGOUT                     0x04
+#define HOST_CMD_LIST                       0x05    // admin, [first index] -> [next index or 0xFF]{[index][length][name]}
+#define HOST_CMD_CREATE                     0x06    // admin, [length][name][length][password] -> [index]
+#define HOST_CMD_DELETE                     0x07    // admin, [index]
+#define HOST_CMD_RESET                      0x08    // admin, erases every user and logs out
+#define HOST_CMD_REGION                     0x09    // admin, -> [layout version][user region size, high byte first]
+#define HOST_CMD_EXPORT                     0x0A    // admin, [offset, high byte first][count] -> [user region bytes]
+#define HOST_CMD_IMPORT                     0x0B    // admin, [offset, high byte first][user region bytes], starts a restore
+#define HOST_CMD_COMMIT                     0x0C    // admin, reloads the user table and ends the restore -> [users][bad records]
+
+/*Reply status*/
+#define HOST_STATUS_OK                      0x00
+#define HOST_STATUS_BAD_CRC                 0x01
+#define HOST_STATUS_UNKNOWN_CMD             0x02
+#define HOST_STATUS_BAD_LENGTH              0x03
+#define HOST_STATUS_DENIED                  0x04
+#define HOST_STATUS_FAILED                  0x05
+#define HOST_STATUS_BUSY                    0x06    // a local session or a restore is using the user table, try again later
+
+u8   HOST_u8Poll                            (void                                                                          );
+u8   HOST_u8SetBusy                         (u8 Copy_u8Busy                                                                );
+
+#endif /* HOST_INTERFACE_H_ */
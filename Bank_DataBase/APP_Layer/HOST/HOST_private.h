@@ -0,0 +1,24 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    HOST_private.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : HOST
+ *
+ */
+
+#ifndef HOST_PRIVATE_H_
+#define HOST_PRIVATE_H_
+
+/*Frame decoder states*/
+#define HOST_WAIT_SOF                       0
+#define HOST_WAIT_STX                       1
+#define HOST_WAIT_LEN                       2
+#define HOST_WAIT_CMD                       3
+#define HOST_WAIT_PAYLOAD                   4
+#define HOST_WAIT_CRC                       5
+
+/*Bytes that never go out raw inside a frame*/
+#define HOST_IS_ESCAPED(Byte)               (((Byte) == HOST_DLE) || ((Byte) == USART_XON) || ((Byte) == USART_XOFF))
+
+#endif /* HOST_PRIVATE_H_ */
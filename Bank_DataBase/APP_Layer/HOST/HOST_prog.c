@@ -0,0 +1,494 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    HOST_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : HOST
+ *
+ */
+
+#include "../STD_TYPES.h"
+#include "../STD_MACROS.h"
+
+#include "HOST_interface.h"
+#include "HOST_private.h"
+#include "HOST_config.h"
+
+#include "../CRC/CRC_interface.h"
+#include "../SECURITY/SECURITY_interface.h"
+
+#include "../../MCAL_Layer/EEPROM/EEPROM_interface.h"
+#include "../../MCAL_Layer/USART/USART_interface.h"
+#include "../../MCAL_Layer/TIMER/TIMER_interface.h"
+
+#if (HOST_MAX_PAYLOAD > 255) || (HOST_MAX_PAYLOAD < (USERNAME_MAX_LENGTH + PASSWORD_MAX_LENGTH + 2))
+#error "HOST_MAX_PAYLOAD must hold a create frame and fit in the length byte"
+#endif
+
+/*User blocks moved by HOST_CMD_EXPORT and HOST_CMD_IMPORT, offsets count from EEPROM_USER_START*/
+#define HOST_USER_REGION_SIZE               ((u16)MAX_USERS * USER_BLOCK_SIZE)
+
+/*Frame being decoded, HOST_u8Escaped is set after a HOST_DLE inside it*/
+static u8 HOST_u8State = HOST_WAIT_SOF;
+static u8 HOST_u8Escaped;
+static u8 HOST_u8Length;
+static u8 HOST_u8Command;
+static u8 HOST_u8Index;
+static u8 HOST_u8Crc;
+static u8 HOST_au8Payload[HOST_MAX_PAYLOAD];
+
+/*Reply being built, status byte first*/
+static u8 HOST_au8Reply[HOST_MAX_PAYLOAD];
+static u8 HOST_u8ReplyLength;
+
+/*Time by which the next byte of an unfinished frame has to arrive*/
+static u32 HOST_u32FrameDeadline;
+
+/*Set while someone works at the keypad, commands that change the user table are refused*/
+static u8 HOST_u8Busy = 0;
+
+/*Set by HOST_CMD_IMPORT until the user table is reloaded, local sessions are refused meanwhile*/
+static u8 HOST_u8Restoring = 0;
+static u32 HOST_u32RestoreDeadline;
+
+/*Admin session, and the time before which logins are refused*/
+static u8 HOST_u8LoggedIn = 0;
+static u8 HOST_u8LoginLocked = 0;
+static u32 HOST_u32LoginDeadline;
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sends one byte of a frame, escaping HOST_DLE, USART_XON and USART_XOFF
+ * Parameters :
+ *      => Copy_u8Byte --> byte after HOST_STX
+ * return     :  Nothing
+ */
+static void HOST_vSendByte(u8 Copy_u8Byte)
+{
+  if (HOST_IS_ESCAPED(Copy_u8Byte))
+  {
+    USART_u8SendData(HOST_DLE);
+    Copy_u8Byte ^= HOST_ESCAPE_XOR;
+  }
+  USART_u8SendData(Copy_u8Byte);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sends the reply in HOST_au8Reply as one frame
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void HOST_vSendReply(void)
+{
+  u8 Local_au8Header[2];
+  u8 Local_u8Crc;
+
+  Local_au8Header[0] = HOST_u8ReplyLength;
+  Local_au8Header[1] = HOST_u8Command | HOST_REPLY_FLAG;
+  Local_u8Crc = CRC_u8Calc8(CRC8_INIT, Local_au8Header, 2);
+  Local_u8Crc = CRC_u8Calc8(Local_u8Crc, HOST_au8Reply, HOST_u8ReplyLength);
+
+  USART_u8SendData(HOST_DLE);
+  USART_u8SendData(HOST_STX);
+  HOST_vSendByte(Local_au8Header[0]);
+  HOST_vSendByte(Local_au8Header[1]);
+  for (u8 Local_u8Index = 0; Local_u8Index < HOST_u8ReplyLength; Local_u8Index++)
+  {
+    HOST_vSendByte(HOST_au8Reply[Local_u8Index]);
+  }
+  HOST_vSendByte(Local_u8Crc);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function fills the reply of HOST_CMD_LIST with as many users as fit in one frame
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void HOST_vListUsers(void)
+{
+  u8 Local_au8Name[USERNAME_MAX_LENGTH + 1];
+  u8 Local_u8Length;
+  u8 Local_u8User;
+
+  /*Index to ask for next, 0xFF once the list is complete*/
+  HOST_au8Reply[1] = 0xFF;
+  HOST_u8ReplyLength = 2;
+
+  for (Local_u8User = HOST_au8Payload[0]; Local_u8User < MAX_USERS; Local_u8User++)
+  {
+    Local_u8Length = User_Get_Name(Local_u8User, Local_au8Name);
+    if (Local_u8Length == 0)
+    {
+      continue;
+    }
+
+    if (HOST_u8ReplyLength + 2 + Local_u8Length > HOST_MAX_PAYLOAD)
+    {
+      HOST_au8Reply[1] = Local_u8User;
+      break;
+    }
+
+    HOST_au8Reply[HOST_u8ReplyLength++] = Local_u8User;
+    HOST_au8Reply[HOST_u8ReplyLength++] = Local_u8Length;
+    for (u8 Local_u8Index = 0; Local_u8Index < Local_u8Length; Local_u8Index++)
+    {
+      HOST_au8Reply[HOST_u8ReplyLength++] = Local_au8Name[Local_u8Index];
+    }
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function checks that a run of the user region is inside it
+ * Parameters :
+ *      => Copy_u16Offset --> first byte, from EEPROM_USER_START
+ *      => Copy_u16Count  --> number of bytes
+ * return     :  1 if the run fits, 0 otherwise
+ */
+static u8 HOST_u8IsInRegion(u16 Copy_u16Offset, u16 Copy_u16Count)
+{
+  return (Copy_u16Offset <= HOST_USER_REGION_SIZE) && (Copy_u16Count <= HOST_USER_REGION_SIZE - Copy_u16Offset);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function reloads the user table once a restore is over
+ * Parameters :
+ *      => Copy_u8Force --> 1 to end it now (commit, logout), 0 only once HOST_RESTORE_TIMEOUT passed
+ * return     :  Nothing
+ */
+static void HOST_vEndRestore(u8 Copy_u8Force)
+{
+  if (HOST_u8Restoring && (Copy_u8Force || TIMER_u8IsExpired(HOST_u32RestoreDeadline)))
+  {
+    /*The RAM directory, the index and the user count still describe the table before the imports*/
+    User_Table_Reload();
+    HOST_u8Restoring = 0;
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function runs a complete frame and sends its reply
+ * Parameters :
+ *      => Copy_u8CrcOk --> 1 if the frame CRC matched
+ * return     :  Nothing
+ */
+static void HOST_vExecute(u8 Copy_u8CrcOk)
+{
+  u8 Local_u8Status = HOST_STATUS_OK;
+  u8 Local_u8NameLength;
+  u8 Local_u8User;
+  u16 Local_u16Offset = ((u16)HOST_au8Payload[0] << 8) | HOST_au8Payload[1];
+
+  HOST_u8ReplyLength = 1;
+
+  if (Copy_u8CrcOk == 0)
+  {
+    Local_u8Status = HOST_STATUS_BAD_CRC;
+  }
+  else if (HOST_u8Length > HOST_MAX_PAYLOAD)
+  {
+    Local_u8Status = HOST_STATUS_BAD_LENGTH;
+  }
+  else if ((HOST_u8Command >= HOST_CMD_LIST) && (HOST_u8Command <= HOST_CMD_COMMIT) && (HOST_u8LoggedIn == 0))
+  {
+    Local_u8Status = HOST_STATUS_DENIED;
+  }
+  else if (HOST_u8Busy && ((HOST_u8Command == HOST_CMD_CREATE) || (HOST_u8Command == HOST_CMD_DELETE) ||
+                           (HOST_u8Command == HOST_CMD_RESET) || (HOST_u8Command == HOST_CMD_IMPORT) ||
+                           (HOST_u8Command == HOST_CMD_COMMIT)))
+  {
+    Local_u8Status = HOST_STATUS_BUSY;
+  }
+  else if (HOST_u8Restoring && ((HOST_u8Command == HOST_CMD_CREATE) || (HOST_u8Command == HOST_CMD_DELETE)))
+  {
+    /*They would work on the directory of the table before the imports*/
+    Local_u8Status = HOST_STATUS_BUSY;
+  }
+  else
+  {
+    switch (HOST_u8Command)
+    {
+    case HOST_CMD_PING:
+      HOST_au8Reply[HOST_u8ReplyLength++] = HOST_PROTOCOL_VERSION;
+      break;
+
+    case HOST_CMD_COUNTERS:
+      HOST_au8Reply[HOST_u8ReplyLength++] = User_Count;
+      HOST_au8Reply[HOST_u8ReplyLength++] = MAX_USERS;
+      HOST_au8Reply[HOST_u8ReplyLength++] = Tries;
+      HOST_au8Reply[HOST_u8ReplyLength++] = Bad_Records;
+      break;
+
+    case HOST_CMD_LOGIN:
+      if (HOST_u8LoginLocked && TIMER_u8IsExpired(HOST_u32LoginDeadline))
+      {
+        HOST_u8LoginLocked = 0;
+      }
+
+      if ((HOST_u8LoginLocked == 0) && Admin_Password_Match(HOST_au8Payload, HOST_u8Length))
+      {
+        HOST_u8LoggedIn = 1;
+      }
+      else
+      {
+        /*Slow down password guessing over the link*/
+        HOST_u8LoginLocked = 1;
+        HOST_u32LoginDeadline = TIMER_u32Deadline(HOST_LOGIN_DELAY);
+        Local_u8Status = HOST_STATUS_DENIED;
+      }
+      break;
+
+    case HOST_CMD_LOGOUT:
+      HOST_vEndRestore(1);
+      HOST_u8LoggedIn = 0;
+      break;
+
+    case HOST_CMD_LIST:
+      if (HOST_u8Length != 1)
+      {
+        Local_u8Status = HOST_STATUS_BAD_LENGTH;
+      }
+      else
+      {
+        HOST_vListUsers();
+      }
+      break;
+
+    case HOST_CMD_CREATE:
+      /*[length][name][length][password]*/
+      Local_u8NameLength = HOST_au8Payload[0];
+      if ((HOST_u8Length < 2) || (Local_u8NameLength > HOST_u8Length - 2) ||
+          (HOST_au8Payload[1 + Local_u8NameLength] != HOST_u8Length - 2 - Local_u8NameLength))
+      {
+        Local_u8Status = HOST_STATUS_BAD_LENGTH;
+      }
+      else
+      {
+        Local_u8User = User_Add(&HOST_au8Payload[1], Local_u8NameLength,
+                                &HOST_au8Payload[2 + Local_u8NameLength], HOST_au8Payload[1 + Local_u8NameLength]);
+        if (Local_u8User == USER_NOT_FOUND)
+        {
+          Local_u8Status = HOST_STATUS_FAILED;
+        }
+        else
+        {
+          HOST_au8Reply[HOST_u8ReplyLength++] = Local_u8User;
+        }
+      }
+      break;
+
+    case HOST_CMD_DELETE:
+      if (HOST_u8Length != 1)
+      {
+        Local_u8Status = HOST_STATUS_BAD_LENGTH;
+      }
+      else if (!User_Remove(HOST_au8Payload[0]))
+      {
+        Local_u8Status = HOST_STATUS_FAILED;
+      }
+      break;
+
+    case HOST_CMD_RESET:
+      /*Reloads the empty table, a restore in progress is over*/
+      Erase_All_Data();
+      HOST_u8Restoring = 0;
+      HOST_u8LoggedIn = 0;
+      break;
+
+    case HOST_CMD_REGION:
+      HOST_au8Reply[HOST_u8ReplyLength++] = EEPROM_LAYOUT_VERSION;
+      HOST_au8Reply[HOST_u8ReplyLength++] = (u8)(HOST_USER_REGION_SIZE >> 8);
+      HOST_au8Reply[HOST_u8ReplyLength++] = (u8)HOST_USER_REGION_SIZE;
+      break;
+
+    case HOST_CMD_EXPORT:
+      if ((HOST_u8Length != 3) || (HOST_au8Payload[2] > HOST_MAX_PAYLOAD - 1) ||
+          !HOST_u8IsInRegion(Local_u16Offset, HOST_au8Payload[2]))
+      {
+        Local_u8Status = HOST_STATUS_BAD_LENGTH;
+      }
+      else
+      {
+        EEPROM_vReadBlock(EEPROM_USER_START + Local_u16Offset, &HOST_au8Reply[1], HOST_au8Payload[2]);
+        HOST_u8ReplyLength += HOST_au8Payload[2];
+      }
+      break;
+
+    case HOST_CMD_IMPORT:
+      /*Bytes already holding their value are skipped, restoring a similar table is quick*/
+      if ((HOST_u8Length < 2) || !HOST_u8IsInRegion(Local_u16Offset, HOST_u8Length - 2))
+      {
+        Local_u8Status = HOST_STATUS_BAD_LENGTH;
+      }
+      else
+      {
+        EEPROM_vWriteBlock(EEPROM_USER_START + Local_u16Offset, &HOST_au8Payload[2], HOST_u8Length - 2);
+        HOST_u8Restoring = 1;
+        HOST_u32RestoreDeadline = TIMER_u32Deadline(HOST_RESTORE_TIMEOUT);
+      }
+      break;
+
+    case HOST_CMD_COMMIT:
+      User_Table_Reload();
+      HOST_u8Restoring = 0;
+      HOST_au8Reply[HOST_u8ReplyLength++] = User_Count;
+      HOST_au8Reply[HOST_u8ReplyLength++] = Bad_Records;
+      break;
+
+    default:
+      Local_u8Status = HOST_STATUS_UNKNOWN_CMD;
+      break;
+    }
+  }
+
+  HOST_au8Reply[0] = Local_u8Status;
+  HOST_vSendReply();
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function decodes host frames from the USART RX ring buffer without waiting
+ *              bytes outside a frame are left in the ring, so the menus still read their keys
+ *              (a HOST_DLE not followed by HOST_STX is dropped, the line editor would drop it too)
+ * Parameters :  Nothing
+ * return     :  OK if a frame was handled, BUSY_STATE while a frame is still arriving, NOK otherwise
+ */
+u8 HOST_u8Poll(void)
+{
+  u8 Local_u8Byte;
+
+  /*A host that went away after its imports leaves a table the RAM does not describe*/
+  HOST_vEndRestore(0);
+
+  while (USART_u8PeekChar(&Local_u8Byte) == OK)
+  {
+    if ((HOST_u8State == HOST_WAIT_SOF) && (Local_u8Byte != HOST_DLE))
+    {
+      /*Not a frame, a key for the menus*/
+      return NOK;
+    }
+
+    if ((HOST_u8State == HOST_WAIT_STX) && (Local_u8Byte != HOST_STX))
+    {
+      /*A lone HOST_DLE, the key after it is for the menus*/
+      HOST_u8State = HOST_WAIT_SOF;
+      return NOK;
+    }
+
+    USART_u8GetChar(&Local_u8Byte);
+    HOST_u32FrameDeadline = TIMER_u32Deadline(HOST_FRAME_TIMEOUT);
+
+    if (HOST_u8State >= HOST_WAIT_LEN)
+    {
+      if (HOST_u8Escaped)
+      {
+        HOST_u8Escaped = 0;
+        if (Local_u8Byte == HOST_STX)
+        {
+          /*An unescaped start, the host gave up on the last frame and sent a new one*/
+          HOST_u8State = HOST_WAIT_LEN;
+          continue;
+        }
+        Local_u8Byte ^= HOST_ESCAPE_XOR;
+      }
+      else if (Local_u8Byte == HOST_DLE)
+      {
+        HOST_u8Escaped = 1;
+        continue;
+      }
+    }
+
+    switch (HOST_u8State)
+    {
+    case HOST_WAIT_SOF:
+      HOST_u8State = HOST_WAIT_STX;
+      break;
+
+    case HOST_WAIT_STX:
+      HOST_u8Escaped = 0;
+      HOST_u8State = HOST_WAIT_LEN;
+      break;
+
+    case HOST_WAIT_LEN:
+      HOST_u8Length = Local_u8Byte;
+      HOST_u8Crc = CRC_u8Calc8(CRC8_INIT, &Local_u8Byte, 1);
+      HOST_u8State = HOST_WAIT_CMD;
+      break;
+
+    case HOST_WAIT_CMD:
+      HOST_u8Command = Local_u8Byte;
+      HOST_u8Crc = CRC_u8Calc8(HOST_u8Crc, &Local_u8Byte, 1);
+      HOST_u8Index = 0;
+      HOST_u8State = (HOST_u8Length == 0) ? HOST_WAIT_CRC : HOST_WAIT_PAYLOAD;
+      break;
+
+    case HOST_WAIT_PAYLOAD:
+      /*An oversized payload is still read to its end, then answered with HOST_STATUS_BAD_LENGTH*/
+      if (HOST_u8Index < HOST_MAX_PAYLOAD)
+      {
+        HOST_au8Payload[HOST_u8Index] = Local_u8Byte;
+      }
+      HOST_u8Index++;
+      HOST_u8Crc = CRC_u8Calc8(HOST_u8Crc, &Local_u8Byte, 1);
+      if (HOST_u8Index == HOST_u8Length)
+      {
+        HOST_u8State = HOST_WAIT_CRC;
+      }
+      break;
+
+    default: /*HOST_WAIT_CRC*/
+      HOST_u8State = HOST_WAIT_SOF;
+      HOST_vExecute(Local_u8Byte == HOST_u8Crc);
+      return OK;
+    }
+  }
+
+  if (HOST_u8State == HOST_WAIT_SOF)
+  {
+    return NOK;
+  }
+
+  /*Drop a frame the host gave up on*/
+  if (TIMER_u8IsExpired(HOST_u32FrameDeadline))
+  {
+    HOST_u8State = HOST_WAIT_SOF;
+    return NOK;
+  }
+
+  return BUSY_STATE;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function tells the decoder whether a local session is running
+ *              frames are still answered then, but the ones changing the user table get HOST_STATUS_BUSY
+ *              no session may start while a restore (HOST_CMD_IMPORT without HOST_CMD_COMMIT yet) runs
+ * Parameters :
+ *      => Copy_u8Busy --> 1 while a prompt or a user menu is open, 0 back at the main menu
+ * return     :  OK, BUSY_STATE if a restore runs, the session is not started then
+ */
+u8 HOST_u8SetBusy(u8 Copy_u8Busy)
+{
+  HOST_vEndRestore(0);
+
+  if (Copy_u8Busy && HOST_u8Restoring)
+  {
+    return BUSY_STATE;
+  }
+
+  HOST_u8Busy = Copy_u8Busy;
+
+  return OK;
+}
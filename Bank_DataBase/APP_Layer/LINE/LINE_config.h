@@ -0,0 +1,27 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    LINE_config.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : LINE
+ *
+ */
+
+#ifndef LINE_CONFIG_H_
+#define LINE_CONFIG_H_
+
+/*Set the keys that finish a line (terminal Enter and keypad Enter)*/
+#define LINE_ENTER_KEY                      0x0D
+#define LINE_ENTER_KEY_ALT                  0x0F
+
+/*Set the keys that erase the last character (Backspace and Delete)*/
+#define LINE_BACKSPACE_KEY                  0x08
+#define LINE_BACKSPACE_KEY_ALT              0x7F
+
+/*Set the character shown instead of hidden input*/
+#define LINE_MASK_CHAR                      '*'
+
+/*Set how many milliseconds a masked character stays readable before it is hidden*/
+#define LINE_MASK_DELAY                     200
+
+#endif /* LINE_CONFIG_H_ */
@@ -0,0 +1,26 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    LINE_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : LINE
+ *
+ */
+
+#ifndef LINE_INTERFACE_H_
+#define LINE_INTERFACE_H_
+
+/*How typed characters are echoed at the LCD cursor*/
+#define LINE_ECHO_PLAIN                     0       // the character itself
+#define LINE_ECHO_MASK                      1       // the character, replaced by LINE_MASK_CHAR after LINE_MASK_DELAY
+#define LINE_ECHO_HIDDEN                    2       // LINE_MASK_CHAR right away
+
+/*
+ * One line is edited at a time, the buffer needs Copy_u8MaxLength + 1 bytes and is '\0' terminated
+ * Enter is ignored below Copy_u8MinLength, printable characters beyond Copy_u8MaxLength are dropped
+ */
+void LINE_vStart                            (u8 *Copy_pu8Buffer, u8 Copy_u8MinLength, u8 Copy_u8MaxLength, u8 Copy_u8Echo  );
+u8   LINE_u8Poll                            (u8 *Copy_pu8Length                                                            );
+u8   LINE_u8Read                            (u8 *Copy_pu8Buffer, u8 Copy_u8MinLength, u8 Copy_u8MaxLength, u8 Copy_u8Echo  );
+
+#endif /* LINE_INTERFACE_H_ */
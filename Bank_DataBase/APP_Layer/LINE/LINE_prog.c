@@ -0,0 +1,180 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    LINE_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : LINE
+ *
+ */
+
+#include "../STD_TYPES.h"
+#include "../STD_MACROS.h"
+
+#include "LINE_interface.h"
+#include "LINE_config.h"
+
+#include "../HOST/HOST_interface.h"
+
+#include "../../MCAL_Layer/USART/USART_interface.h"
+#include "../../MCAL_Layer/TIMER/TIMER_interface.h"
+#include "../../HAL_Layer/CLCD/CLCD_interface.h"
+
+/*Line being edited*/
+static u8 *LINE_pu8Buffer = NULL;
+static u8 LINE_u8Length;
+static u8 LINE_u8MinLength;
+static u8 LINE_u8MaxLength;
+static u8 LINE_u8Echo;
+
+/*Last character is still readable on the LCD (LINE_ECHO_MASK), and when to hide it*/
+static u8 LINE_u8MaskPending = 0;
+static u32 LINE_u32MaskDeadline;
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function replaces the readable last character with LINE_MASK_CHAR
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void LINE_vHideLast(void)
+{
+  CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
+  CLCD_vSendData(LINE_MASK_CHAR);
+  LINE_u8MaskPending = 0;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function starts editing a new empty line at the current LCD cursor
+ * Parameters :
+ *            => Copy_pu8Buffer   : line buffer, Copy_u8MaxLength + 1 bytes
+ *            => Copy_u8MinLength : shortest line accepted by Enter
+ *            => Copy_u8MaxLength : longest line
+ *            => Copy_u8Echo      : LINE_ECHO_PLAIN, LINE_ECHO_MASK or LINE_ECHO_HIDDEN
+ * return     :  Nothing
+ */
+void LINE_vStart(u8 *Copy_pu8Buffer, u8 Copy_u8MinLength, u8 Copy_u8MaxLength, u8 Copy_u8Echo)
+{
+  LINE_pu8Buffer = Copy_pu8Buffer;
+  LINE_u8Length = 0;
+  LINE_u8MinLength = Copy_u8MinLength;
+  LINE_u8MaxLength = Copy_u8MaxLength;
+  LINE_u8Echo = Copy_u8Echo;
+  LINE_u8MaskPending = 0;
+
+  if (LINE_pu8Buffer != NULL)
+  {
+    LINE_pu8Buffer[0] = '\0';
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function edits the line with the keys waiting in the USART RX ring buffer without waiting
+ *              keys after Enter stay in the ring for the next reader, host frames are passed to HOST_u8Poll
+ * Parameters :
+ *            => Copy_pu8Length : length of the finished line (may be NULL)
+ * return     :  OK when Enter finished the line, BUSY_STATE while editing, NULL_POINTER without LINE_vStart
+ */
+u8 LINE_u8Poll(u8 *Copy_pu8Length)
+{
+  u8 Local_u8Key;
+
+  if (LINE_pu8Buffer == NULL)
+  {
+    return NULL_POINTER;
+  }
+
+  if (LINE_u8MaskPending && TIMER_u8IsExpired(LINE_u32MaskDeadline))
+  {
+    LINE_vHideLast();
+  }
+
+  /*Host frames are answered here too, so their bytes never end up in the line*/
+  while ((HOST_u8Poll() == NOK) && (USART_u8GetChar(&Local_u8Key) == OK))
+  {
+    if ((Local_u8Key == LINE_ENTER_KEY) || (Local_u8Key == LINE_ENTER_KEY_ALT))
+    {
+      if (LINE_u8Length >= LINE_u8MinLength)
+      {
+        if (LINE_u8MaskPending)
+        {
+          LINE_vHideLast();
+        }
+
+        LINE_pu8Buffer[LINE_u8Length] = '\0';
+        if (Copy_pu8Length != NULL)
+        {
+          *Copy_pu8Length = LINE_u8Length;
+        }
+        LINE_pu8Buffer = NULL;
+        return OK;
+      }
+    }
+    else if ((Local_u8Key == LINE_BACKSPACE_KEY) || (Local_u8Key == LINE_BACKSPACE_KEY_ALT))
+    {
+      if (LINE_u8Length > 0)
+      {
+        LINE_u8Length--;
+        LINE_u8MaskPending = 0;
+        CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
+        CLCD_vSendData(' ');
+        CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
+      }
+    }
+    else if ((Local_u8Key >= ' ') && (LINE_u8Length < LINE_u8MaxLength))
+    {
+      /*Hide the previous character before the cursor moves on*/
+      if (LINE_u8MaskPending)
+      {
+        LINE_vHideLast();
+      }
+
+      LINE_pu8Buffer[LINE_u8Length++] = Local_u8Key;
+
+      if (LINE_u8Echo == LINE_ECHO_HIDDEN)
+      {
+        CLCD_vSendData(LINE_MASK_CHAR);
+      }
+      else
+      {
+        CLCD_vSendData(Local_u8Key);
+        if (LINE_u8Echo == LINE_ECHO_MASK)
+        {
+          LINE_u8MaskPending = 1;
+          LINE_u32MaskDeadline = TIMER_u32Deadline(LINE_MASK_DELAY);
+        }
+      }
+    }
+    else
+    {
+      /*Control characters and keys beyond the length limit are dropped*/
+    }
+  }
+
+  return BUSY_STATE;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function edits a whole line, waiting until Enter is accepted
+ * Parameters :
+ *            => Copy_pu8Buffer   : line buffer, Copy_u8MaxLength + 1 bytes
+ *            => Copy_u8MinLength : shortest line accepted by Enter
+ *            => Copy_u8MaxLength : longest line
+ *            => Copy_u8Echo      : LINE_ECHO_PLAIN, LINE_ECHO_MASK or LINE_ECHO_HIDDEN
+ * return     :  Length of the line
+ */
+u8 LINE_u8Read(u8 *Copy_pu8Buffer, u8 Copy_u8MinLength, u8 Copy_u8MaxLength, u8 Copy_u8Echo)
+{
+  u8 Local_u8Length = 0;
+
+  LINE_vStart(Copy_pu8Buffer, Copy_u8MinLength, Copy_u8MaxLength, Copy_u8Echo);
+  while (LINE_u8Poll(&Local_u8Length) == BUSY_STATE);
+
+  return Local_u8Length;
+}
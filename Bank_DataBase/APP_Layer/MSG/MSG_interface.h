@@ -0,0 +1,97 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    MSG_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : MSG
+ *
+ */
+
+#ifndef MSG_INTERFACE_H_
+#define MSG_INTERFACE_H_
+
+/*Every UI text lives in flash, these are its numbers in the message table*/
+
+/* Boot and main menu */
+#define MSG_WELCOME_TO                      0
+#define MSG_ADVANCED_SAFE                   1
+#define MSG_DEVELOPED_BY                    2
+#define MSG_AUTHOR                          3
+#define MSG_INITIALIZING                    4
+#define MSG_INIT_LCD                        5
+#define MSG_INIT_USART                      6
+#define MSG_INIT_EEPROM                     7
+#define MSG_OK                              8
+#define MSG_MENU_SIGN_IN                    9
+#define MSG_MENU_NEW_USER                   10
+#define MSG_USERS                           11
+#define MSG_BAD                             12
+#define MSG_SYSTEM_READY                    13
+#define MSG_ERROR                           14
+#define MSG_INPUT_TIMEOUT                   15
+#define MSG_INVALID_CHOICE                  16
+#define MSG_EEPROM_FULL                     17
+#define MSG_MAX_USERS                       18
+#define MSG_SPACE_LEFT                      19
+#define MSG_BENCHMARK                       20
+
+/* Sign in and sign up */
+#define MSG_ENTER_USERNAME                  21
+#define MSG_ENTER_PASSWORD                  22
+#define MSG_INVALID_LOGIN                   23
+#define MSG_TRIES_LEFT                      24
+#define MSG_LOGIN_SUCCESS_BANNER            25
+#define MSG_WELCOME                         26
+#define MSG_TIME_OUT                        27
+#define MSG_LOADING                         28
+#define MSG_MAX_USERS_REACHED               29
+#define MSG_SET_USERNAME                    30
+#define MSG_RESET_USERNAME                  31
+#define MSG_SET_PASSWORD                    32
+#define MSG_RESET_PASSWORD                  33
+#define MSG_MAX_CHARS                       34
+#define MSG_MIN_LENGTH                      35
+
+/* Account management */
+#define MSG_NEW_USERNAME                    36
+#define MSG_USERNAME_EXISTS                 37
+#define MSG_CURRENT_PASS                    38
+#define MSG_WRONG_PASSWORD                  39
+#define MSG_NEW_PASSWORD                    40
+#define MSG_MIN_LEN                         41
+#define MSG_WEAK_PASSWORD                   42
+#define MSG_PASSWORD_RULES                  43
+#define MSG_ENTER_PASS_TO                   44
+#define MSG_DELETE_ACCOUNT                  45
+#define MSG_USERS_LIST                      46
+#define MSG_MORE                            47
+#define MSG_COLON                           48
+#define MSG_USER_NUMBER                     49
+
+/* User and admin menus */
+#define MSG_MENU_CHANGE_PASS                50
+#define MSG_MENU_CHANGE_USER                51
+#define MSG_MENU_DELETE_ACCOUNT             52
+#define MSG_MENU_LOGOUT                     53
+#define MSG_MENU_LIST_USERS                 54
+#define MSG_MENU_DELETE_USER                55
+#define MSG_MENU_USER_MENU                  56
+#define MSG_MENU_FACTORY_RESET              57
+
+/* Log events */
+#define MSG_LOGIN_SUCCESS                   58
+#define MSG_LOGIN_FAILED                    59
+#define MSG_PASS_CHANGED                    60
+#define MSG_USER_CHANGED                    61
+#define MSG_USER_DELETED                    62
+#define MSG_USER_CREATED                    63
+
+/* Host link */
+#define MSG_RESTORE_RUNNING                 64
+
+#define MSG_COUNT                           65
+
+const u8 *MSG_pu8Get                        (u8 Copy_u8Id                                                                  );
+void MSG_vShow                              (u8 Copy_u8Id                                                                  );
+
+#endif /* MSG_INTERFACE_H_ */
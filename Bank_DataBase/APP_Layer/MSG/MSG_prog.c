@@ -0,0 +1,199 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    MSG_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : APP_Layer
+ *  SWC    : MSG
+ *
+ */
+
+#include <avr/pgmspace.h>
+
+#include "../STD_TYPES.h"
+#include "../STD_MACROS.h"
+
+#include "MSG_interface.h"
+
+#include "../../HAL_Layer/CLCD/CLCD_interface.h"
+
+/*Texts are kept in flash only, nothing of them is copied to SRAM at startup*/
+
+/* Boot and main menu */
+static const u8 MSG_au8WelcomeTo[]            PROGMEM = "     Welcome to";
+static const u8 MSG_au8AdvancedSafe[]         PROGMEM = "   Advanced Safe";
+static const u8 MSG_au8DevelopedBy[]          PROGMEM = "Developed by:";
+static const u8 MSG_au8Author[]               PROGMEM = "Abdallah Shehawey";
+static const u8 MSG_au8Initializing[]         PROGMEM = "Initializing";
+static const u8 MSG_au8InitLcd[]              PROGMEM = "LCD...";
+static const u8 MSG_au8InitUsart[]            PROGMEM = "USART...";
+static const u8 MSG_au8InitEeprom[]           PROGMEM = "EEPROM...";
+static const u8 MSG_au8Ok[]                   PROGMEM = "OK";
+static const u8 MSG_au8MenuSignIn[]           PROGMEM = "1:Sign In";
+static const u8 MSG_au8MenuNewUser[]          PROGMEM = "2:New User";
+static const u8 MSG_au8Users[]                PROGMEM = "Users:";
+static const u8 MSG_au8Bad[]                  PROGMEM = " Bad:";
+static const u8 MSG_au8SystemReady[]          PROGMEM = "System Ready";
+static const u8 MSG_au8Error[]                PROGMEM = "Error:";
+static const u8 MSG_au8InputTimeout[]         PROGMEM = "Input Timeout!";
+static const u8 MSG_au8InvalidChoice[]        PROGMEM = "Invalid Choice!";
+static const u8 MSG_au8EepromFull[]           PROGMEM = "EEPROM Full!";
+static const u8 MSG_au8MaxUsers[]             PROGMEM = "Max Users: ";
+static const u8 MSG_au8SpaceLeft[]            PROGMEM = "Space Left: ";
+static const u8 MSG_au8Benchmark[]            PROGMEM = "Benchmark...";
+
+/* Sign in and sign up */
+static const u8 MSG_au8EnterUsername[]        PROGMEM = "Enter Username";
+static const u8 MSG_au8EnterPassword[]        PROGMEM = "Enter Password";
+static const u8 MSG_au8InvalidLogin[]         PROGMEM = "Invalid Login";
+static const u8 MSG_au8TriesLeft[]            PROGMEM = "Tries Left: ";
+static const u8 MSG_au8LoginSuccessBanner[]   PROGMEM = "Login Success!";
+static const u8 MSG_au8Welcome[]              PROGMEM = "Welcome ";
+static const u8 MSG_au8TimeOut[]              PROGMEM = "Time out: ";
+static const u8 MSG_au8Loading[]              PROGMEM = "Loading ...";
+static const u8 MSG_au8MaxUsersReached[]      PROGMEM = "Max Users Reached";
+static const u8 MSG_au8SetUsername[]          PROGMEM = "Set UserName";
+static const u8 MSG_au8ResetUsername[]        PROGMEM = "Re Set UserName";
+static const u8 MSG_au8SetPassword[]          PROGMEM = "Set Password";
+static const u8 MSG_au8ResetPassword[]        PROGMEM = "Re Set Password";
+static const u8 MSG_au8MaxChars[]             PROGMEM = "Max chars: ";
+static const u8 MSG_au8MinLength[]            PROGMEM = "Min Length: ";
+
+/* Account management */
+static const u8 MSG_au8NewUsername[]          PROGMEM = "New Username:";
+static const u8 MSG_au8UsernameExists[]       PROGMEM = "Username exists!";
+static const u8 MSG_au8CurrentPass[]          PROGMEM = "Current Pass:";
+static const u8 MSG_au8WrongPassword[]        PROGMEM = "Wrong Password!";
+static const u8 MSG_au8NewPassword[]          PROGMEM = "New Password:";
+static const u8 MSG_au8MinLen[]               PROGMEM = "Min len: ";
+static const u8 MSG_au8WeakPassword[]         PROGMEM = "Weak Password!";
+static const u8 MSG_au8PasswordRules[]        PROGMEM = "Need: A,a,1,@";
+static const u8 MSG_au8EnterPassTo[]          PROGMEM = "Enter Pass to";
+static const u8 MSG_au8DeleteAccount[]        PROGMEM = "Delete Account";
+static const u8 MSG_au8UsersList[]            PROGMEM = "Users List:";
+static const u8 MSG_au8More[]                 PROGMEM = "More...";
+static const u8 MSG_au8Colon[]                PROGMEM = ": ";
+static const u8 MSG_au8UserNumber[]           PROGMEM = "User Number:";
+
+/* User and admin menus */
+static const u8 MSG_au8MenuChangePass[]       PROGMEM = "1:Change Pass";
+static const u8 MSG_au8MenuChangeUser[]       PROGMEM = "2:Change User";
+static const u8 MSG_au8MenuDeleteAccount[]    PROGMEM = "3:Delete Account";
+static const u8 MSG_au8MenuLogout[]           PROGMEM = "4:Logout";
+static const u8 MSG_au8MenuListUsers[]        PROGMEM = "1:List Users";
+static const u8 MSG_au8MenuDeleteUser[]       PROGMEM = "2:Delete User";
+static const u8 MSG_au8MenuUserMenu[]         PROGMEM = "3:User Menu";
+static const u8 MSG_au8MenuFactoryReset[]     PROGMEM = "4:Factory Reset";
+
+/* Log events */
+static const u8 MSG_au8LoginSuccess[]         PROGMEM = "Login: Success";
+static const u8 MSG_au8LoginFailed[]          PROGMEM = "Login: Failed";
+static const u8 MSG_au8PassChanged[]          PROGMEM = "Pass Changed";
+static const u8 MSG_au8UserChanged[]          PROGMEM = "User Changed";
+static const u8 MSG_au8UserDeleted[]          PROGMEM = "User Deleted";
+static const u8 MSG_au8UserCreated[]          PROGMEM = "User Created";
+
+/* Host link */
+static const u8 MSG_au8RestoreRunning[]       PROGMEM = "Restore Running";
+
+/*Message table, in flash as well*/
+static const u8 *const MSG_apu8Table[MSG_COUNT] PROGMEM =
+{
+  [MSG_WELCOME_TO]              = MSG_au8WelcomeTo,
+  [MSG_ADVANCED_SAFE]           = MSG_au8AdvancedSafe,
+  [MSG_DEVELOPED_BY]            = MSG_au8DevelopedBy,
+  [MSG_AUTHOR]                  = MSG_au8Author,
+  [MSG_INITIALIZING]            = MSG_au8Initializing,
+  [MSG_INIT_LCD]                = MSG_au8InitLcd,
+  [MSG_INIT_USART]              = MSG_au8InitUsart,
+  [MSG_INIT_EEPROM]             = MSG_au8InitEeprom,
+  [MSG_OK]                      = MSG_au8Ok,
+  [MSG_MENU_SIGN_IN]            = MSG_au8MenuSignIn,
+  [MSG_MENU_NEW_USER]           = MSG_au8MenuNewUser,
+  [MSG_USERS]                   = MSG_au8Users,
+  [MSG_BAD]                     = MSG_au8Bad,
+  [MSG_SYSTEM_READY]            = MSG_au8SystemReady,
+  [MSG_ERROR]                   = MSG_au8Error,
+  [MSG_INPUT_TIMEOUT]           = MSG_au8InputTimeout,
+  [MSG_INVALID_CHOICE]          = MSG_au8InvalidChoice,
+  [MSG_EEPROM_FULL]             = MSG_au8EepromFull,
+  [MSG_MAX_USERS]               = MSG_au8MaxUsers,
+  [MSG_SPACE_LEFT]              = MSG_au8SpaceLeft,
+  [MSG_BENCHMARK]               = MSG_au8Benchmark,
+  [MSG_ENTER_USERNAME]          = MSG_au8EnterUsername,
+  [MSG_ENTER_PASSWORD]          = MSG_au8EnterPassword,
+  [MSG_INVALID_LOGIN]           = MSG_au8InvalidLogin,
+  [MSG_TRIES_LEFT]              = MSG_au8TriesLeft,
+  [MSG_LOGIN_SUCCESS_BANNER]    = MSG_au8LoginSuccessBanner,
+  [MSG_WELCOME]                 = MSG_au8Welcome,
+  [MSG_TIME_OUT]                = MSG_au8TimeOut,
+  [MSG_LOADING]                 = MSG_au8Loading,
+  [MSG_MAX_USERS_REACHED]       = MSG_au8MaxUsersReached,
+  [MSG_SET_USERNAME]            = MSG_au8SetUsername,
+  [MSG_RESET_USERNAME]          = MSG_au8ResetUsername,
+  [MSG_SET_PASSWORD]            = MSG_au8SetPassword,
+  [MSG_RESET_PASSWORD]          = MSG_au8ResetPassword,
+  [MSG_MAX_CHARS]               = MSG_au8MaxChars,
+  [MSG_MIN_LENGTH]              = MSG_au8MinLength,
+  [MSG_NEW_USERNAME]            = MSG_au8NewUsername,
+  [MSG_USERNAME_EXISTS]         = MSG_au8UsernameExists,
+  [MSG_CURRENT_PASS]            = MSG_au8CurrentPass,
+  [MSG_WRONG_PASSWORD]          = MSG_au8WrongPassword,
+  [MSG_NEW_PASSWORD]            = MSG_au8NewPassword,
+  [MSG_MIN_LEN]                 = MSG_au8MinLen,
+  [MSG_WEAK_PASSWORD]           = MSG_au8WeakPassword,
+  [MSG_PASSWORD_RULES]          = MSG_au8PasswordRules,
+  [MSG_ENTER_PASS_TO]           = MSG_au8EnterPassTo,
+  [MSG_DELETE_ACCOUNT]          = MSG_au8DeleteAccount,
+  [MSG_USERS_LIST]              = MSG_au8UsersList,
+  [MSG_MORE]                    = MSG_au8More,
+  [MSG_COLON]                   = MSG_au8Colon,
+  [MSG_USER_NUMBER]             = MSG_au8UserNumber,
+  [MSG_MENU_CHANGE_PASS]        = MSG_au8MenuChangePass,
+  [MSG_MENU_CHANGE_USER]        = MSG_au8MenuChangeUser,
+  [MSG_MENU_DELETE_ACCOUNT]     = MSG_au8MenuDeleteAccount,
+  [MSG_MENU_LOGOUT]             = MSG_au8MenuLogout,
+  [MSG_MENU_LIST_USERS]         = MSG_au8MenuListUsers,
+  [MSG_MENU_DELETE_USER]        = MSG_au8MenuDeleteUser,
+  [MSG_MENU_USER_MENU]          = MSG_au8MenuUserMenu,
+  [MSG_MENU_FACTORY_RESET]      = MSG_au8MenuFactoryReset,
+  [MSG_LOGIN_SUCCESS]           = MSG_au8LoginSuccess,
+  [MSG_LOGIN_FAILED]            = MSG_au8LoginFailed,
+  [MSG_PASS_CHANGED]            = MSG_au8PassChanged,
+  [MSG_USER_CHANGED]            = MSG_au8UserChanged,
+  [MSG_USER_DELETED]            = MSG_au8UserDeleted,
+  [MSG_USER_CREATED]            = MSG_au8UserCreated,
+  [MSG_RESTORE_RUNNING]         = MSG_au8RestoreRunning,
+};
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function returns the flash address of a message
+ * Parameters :
+ *            => Copy_u8Id : message number (MSG_...)
+ * return     :  Address in flash, for the *_P functions, NULL for an unknown number
+ */
+const u8 *MSG_pu8Get(u8 Copy_u8Id)
+{
+  const u8 *Local_pu8String = NULL;
+
+  if (Copy_u8Id < MSG_COUNT)
+  {
+    Local_pu8String = (const u8 *)pgm_read_ptr(&MSG_apu8Table[Copy_u8Id]);
+  }
+
+  return Local_pu8String;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function writes a message at the LCD cursor
+ * Parameters :
+ *            => Copy_u8Id : message number (MSG_...)
+ * return     :  Nothing
+ */
+void MSG_vShow(u8 Copy_u8Id)
+{
+  CLCD_vSendString_P(MSG_pu8Get(Copy_u8Id));
+}
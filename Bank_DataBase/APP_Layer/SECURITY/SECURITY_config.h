@@ -19,16 +19,53 @@
 
 /* EEPROM Memory Layout */
 #define EEPROM_USER_START                0x20
-#define USER_BLOCK_SIZE                  0x2A
+#define USER_BLOCK_SIZE                  0x1A    // [length][name 20][password digest 4][crc]
+
+/* Username Hash Index (64 buckets + 1 check byte, right after the user blocks) */
+#define EEPROM_INDEX_START               0x37A
+#define EEPROM_INDEX_CHECK_LOCATION      0x3BA
+#define INDEX_SIZE                       64      // must be a power of two greater than MAX_USERS
+#define INDEX_EMPTY                      0xFF
+
+/* Write-Ahead Journal (marker, address, count, data, extra byte - below the end of the EEPROM) */
+#define EEPROM_JOURNAL_START             0x3BC
+#define JOURNAL_ADDRESS_OFFSET           0x01    // high byte first, block index for JOURNAL_PROMOTE
+#define JOURNAL_COUNT_OFFSET             0x03
+#define JOURNAL_DATA_OFFSET              0x04
+#define JOURNAL_DATA_SIZE                21      // largest record field: length byte + 20 characters
+#define JOURNAL_EXTRA_OFFSET             0x19    // address (high byte first) and value of one more byte
+                                                 // written with the field, the record CRC
+#define JOURNAL_NO_EXTRA                 0xFFFF
+#define JOURNAL_EMPTY                    0xFF
+#define JOURNAL_COMMITTED                0xA5    // field write waiting to be applied
+#define JOURNAL_PROMOTE                  0x5A    // user block copy into block 0 waiting to be applied
+
+/* Failed-Login Counter Ring (cell = pass bit 7 + value, ends below EEPROM_SYSTEM_STATUS) */
+#define TRIES_RING_SIZE                  16
+#define TRIES_RING_PHASE                 0x80
+#define TRIES_RING_EMPTY                 0x7F    // stands for NOTPRESSED, no failed login pending
+
+/* User Block Status (kept in the username length byte) */
+#define USER_SLOT_FREE                   0xFF
+#define EEPROM_LAYOUT_VERSION            0x04    // stored at EEPROM_SYSTEM_STATUS once the layout is migrated
+
+/* The original layout kept 42 byte blocks with the plain password, packed at the front */
+#define OLD_USER_BLOCK_SIZE              0x2A
+#define OLD_USER_BLOCKS                  23      // the last block starts at EEPROM_JOURNAL_START
+#define EEPROM_STAGE_START               0x3E6   // digest record copy of the last old block
+#define OLD_USER_PASS_LENGTH_OFFSET      0x15
+#define MIGRATION_IDLE                   0xFF    // EEPROM_MIGRATION_PROGRESS when no migration runs
 
 /* User Data Block Offsets */
 #define USER_NAME_LENGTH_OFFSET          0x00
 #define USER_NAME_START_OFFSET           0x01
-#define USER_PASS_LENGTH_OFFSET          0x15
-#define USER_PASS_START_OFFSET           0x16
+#define USER_DIGEST_OFFSET               0x15
+#define USER_CRC_OFFSET                  0x19
+#define PASSWORD_DIGEST_SIZE             4
 
 /* System Constants */
 #define NOTPRESSED                       0xFF
-#define MAX_USERS                        23
+#define MAX_USERS                        33      // user blocks that fit below EEPROM_INDEX_START
+#define USER_NOT_FOUND                   0xFF
 
 #endif /* SECURITY_CONFIG_H_ */
@@ -15,8 +15,10 @@
 #define EEPROM_END_ADDRESS         0x3FF // 1024 bytes total
 
 /* System Status Locations */
+#define EEPROM_TRIES_RING_START    0x00 // TRIES_RING_SIZE cells, wear-leveled copy of Tries
 #define EEPROM_SYSTEM_STATUS       0x10 // 1 byte for system status flags
-#define EEPROM_NoTries_Location    0x12
+#define EEPROM_MIGRATION_PROGRESS  0x11 // Next step of an unfinished layout migration, 0xFF when idle
+#define EEPROM_NoTries_Location    0x12 // Old single Tries cell, moved into the ring at boot
 #define EEPROM_UserCount_Location  0x13
 
 
@@ -74,6 +76,14 @@ void Error_TimeOut(void                       );
 
 /* Backup and Recovery */
 void Factory_Reset(void                       );
+void Erase_All_Data(void                      );
+
+/* Host Access (no LCD output, used by the host protocol) */
+u8   User_Add(u8 *username, u8 username_length, u8 *password, u8 password_length);
+bool User_Remove(u8 user_index                );
+u8   User_Get_Name(u8 user_index, u8 *username);
+bool Admin_Password_Match(u8 *password, u8 length);
+void User_Table_Reload(void                   );
 
 /* Event Logging */
 void Log_Event(u8 event_type, u8 user_index   );
@@ -96,5 +106,6 @@ extern volatile u8 PassWord_Check_Flag;
 extern volatile u8 Current_User;
 extern volatile u8 User_Count;
 extern volatile u8 Is_Admin;
+extern volatile u8 Bad_Records;
 
 #endif /* SECURITY_INTERFACE_H_ */
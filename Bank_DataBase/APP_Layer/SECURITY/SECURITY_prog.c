@@ -15,11 +15,67 @@
 #include "SECURITY_config.h"
 #include "SECURITY_interface.h"
 
+#include "../CRC/CRC_interface.h"
+#include "../HOST/HOST_interface.h"
+#include "../LINE/LINE_interface.h"
+#include "../MSG/MSG_interface.h"
+
 #include "../../MCAL_Layer/DIO/DIO_interface.h"
 #include "../../MCAL_Layer/EEPROM/EEPROM_interface.h"
 #include "../../MCAL_Layer/USART/USART_interface.h"
 #include "../../HAL_Layer/CLCD/CLCD_interface.h"
 
+#if (EEPROM_USER_START + (MAX_USERS * USER_BLOCK_SIZE)) > EEPROM_INDEX_START
+#error "MAX_USERS user blocks overlap the username index"
+#endif
+
+#if (MAX_USERS < OLD_USER_BLOCKS)
+#error "MAX_USERS must keep every user block of the original layout"
+#endif
+
+#if (EEPROM_INDEX_CHECK_LOCATION != EEPROM_INDEX_START + INDEX_SIZE) || (EEPROM_INDEX_CHECK_LOCATION >= EEPROM_JOURNAL_START)
+#error "The username index overlaps the journal"
+#endif
+
+#if (JOURNAL_DATA_OFFSET + JOURNAL_DATA_SIZE) > JOURNAL_EXTRA_OFFSET || (EEPROM_JOURNAL_START + JOURNAL_EXTRA_OFFSET + 3) > (EEPROM_END_ADDRESS + 1)
+#error "The journal does not fit in the EEPROM"
+#endif
+
+#if (JOURNAL_DATA_SIZE < USERNAME_MAX_LENGTH + 1) || (JOURNAL_DATA_SIZE < PASSWORD_DIGEST_SIZE + 1)
+#error "JOURNAL_DATA_SIZE must hold the username field and the password digest with the CRC"
+#endif
+
+#if (USER_DIGEST_OFFSET != USER_NAME_START_OFFSET + USERNAME_MAX_LENGTH) || (USER_CRC_OFFSET != USER_DIGEST_OFFSET + PASSWORD_DIGEST_SIZE)
+#error "Wrong user block offsets"
+#endif
+
+#if (USER_BLOCK_SIZE > OLD_USER_BLOCK_SIZE) || (USER_DIGEST_OFFSET > OLD_USER_PASS_LENGTH_OFFSET) || \
+    (EEPROM_USER_START + ((OLD_USER_BLOCKS - 1) * OLD_USER_BLOCK_SIZE)) > EEPROM_JOURNAL_START
+#error "The layout migration would overwrite old blocks before reading them"
+#endif
+
+#if (EEPROM_STAGE_START < EEPROM_USER_START + (OLD_USER_BLOCKS * OLD_USER_BLOCK_SIZE)) || \
+    (EEPROM_STAGE_START < EEPROM_JOURNAL_START + JOURNAL_EXTRA_OFFSET + 3) || \
+    (EEPROM_STAGE_START + USER_BLOCK_SIZE) > (EEPROM_END_ADDRESS + 1)
+#error "The staged copy of the last old block overlaps the old blocks or the journal"
+#endif
+
+#if (INDEX_SIZE <= MAX_USERS) || (INDEX_SIZE & (INDEX_SIZE - 1))
+#error "INDEX_SIZE must be a power of two greater than MAX_USERS"
+#endif
+
+#if (EEPROM_TRIES_RING_START + TRIES_RING_SIZE) > EEPROM_SYSTEM_STATUS
+#error "The tries ring overlaps the system status bytes"
+#endif
+
+#if Tries_Max >= TRIES_RING_EMPTY
+#error "Tries_Max does not fit in a tries ring cell"
+#endif
+
+#if (USER_NAME_START_OFFSET != USER_NAME_LENGTH_OFFSET + 1)
+#error "The username must directly follow its length byte"
+#endif
+
 /* Global Variables - System State */
 volatile u8 Error_State;             // Current operation error state
 volatile u8 KPD_Press;               // Last keypad press value
@@ -31,8 +87,36 @@ volatile u8 Check[21];               // Buffer for verification operations
 volatile u8 UserName_Check_Flag = 1; // Username verification flag
 volatile u8 PassWord_Check_Flag = 1; // Password verification flag
 volatile u8 Current_User = 0;        // Index of currently active user
-volatile u8 User_Count = 0;          // Total number of registered users
+volatile u8 User_Count = 0;          // Number of used user blocks
 volatile u8 Is_Admin = 0;            // Admin privilege flag
+volatile u8 Bad_Records = 0;         // User blocks that failed their CRC at boot
+
+/* RAM User Directory - mirrors the username of every EEPROM user block */
+static u8 Directory_Length[MAX_USERS]; // Username length per user block, USER_SLOT_FREE if unused
+static u8 Directory_Hash[MAX_USERS];   // Username fingerprint per user block
+
+/* Username Hash Index - open addressing table mirrored at EEPROM_INDEX_START */
+static u8 Index_Table[INDEX_SIZE];     // User index per bucket, INDEX_EMPTY if free
+static u8 Index_Check;                 // XOR check byte of the table
+
+/* Free User Blocks - stack of unused block indexes, lowest index on top */
+static u8 Free_Slots[MAX_USERS];
+static u8 Free_Count = 0;
+
+/* Background EEPROM Writes */
+static const u8 Slot_Free_Status = USER_SLOT_FREE;
+
+/* Write-Ahead Journal - staged copy of the journal body from JOURNAL_ADDRESS_OFFSET on */
+static u8 Journal_Stage[JOURNAL_DATA_OFFSET - JOURNAL_ADDRESS_OFFSET + JOURNAL_DATA_SIZE];
+static u8 Journal_Extra[3];          // Staged copy of the extra byte address and value
+static volatile u8 Journal_Busy = 0; // Cleared once the queued transaction is applied and released
+static const u8 Journal_Committed = JOURNAL_COMMITTED;
+static const u8 Journal_Empty = JOURNAL_EMPTY;
+
+/* Failed-Login Counter Ring - each update programs the next cell, the pass bit
+ * flips every lap so the newest cell is the one before the first bit change */
+static u8 Tries_Ring[TRIES_RING_SIZE]; // Mirror of the ring cells
+static u8 Tries_Ring_Head = 0;         // Cell the next update goes to
 
 //=====================================================================================//
 
@@ -48,6 +132,635 @@ static u16 Get_User_Base_Address(u8 user_index)
   return EEPROM_USER_START + (user_index * USER_BLOCK_SIZE);
 }
 
+/**
+ * @brief Queues a RAM buffer to be written to EEPROM in the background
+ * @param address EEPROM address of the first byte
+ * @param data Buffer to write, read when each byte is written so later changes are written too
+ * @param size Number of bytes
+ * @param done Called once the buffer is written, may be NULL
+ * @details Only waits while the EEPROM write queue is full
+ */
+static void Save_Async(u16 address, const u8 *data, u8 size, void (*done)(void))
+{
+  while (EEPROM_u8WriteBufferAsynch(address, data, size, done) == BUSY_STATE)
+    ;
+}
+
+static void Journal_Done(void)
+{
+  Journal_Busy = 0;
+}
+
+/**
+ * @brief Writes a record field through the journal in the background
+ * @param address EEPROM address of the field
+ * @param data Field bytes
+ * @param count Number of bytes, at most JOURNAL_DATA_SIZE
+ * @param extra_address Address of one more byte written with the field, JOURNAL_NO_EXTRA if none
+ * @param extra_value Value of that byte
+ * @details Queues the journal body, the commit marker, the field and the
+ *          extra byte, then the release of the journal, in that order. A
+ *          brown-out before the marker lands leaves the field untouched,
+ *          after it the boot replay finishes the write.
+ */
+static void Journal_Write(u16 address, const u8 *data, u8 count, u16 extra_address, u8 extra_value)
+{
+  while (Journal_Busy)
+    ; // Previous transaction still in the queue
+
+  Journal_Stage[0] = (u8)(address >> 8);
+  Journal_Stage[1] = (u8)address;
+  Journal_Stage[JOURNAL_COUNT_OFFSET - JOURNAL_ADDRESS_OFFSET] = count;
+  for (u8 i = 0; i < count; i++)
+  {
+    Journal_Stage[JOURNAL_DATA_OFFSET - JOURNAL_ADDRESS_OFFSET + i] = data[i];
+  }
+  Journal_Extra[0] = (u8)(extra_address >> 8);
+  Journal_Extra[1] = (u8)extra_address;
+  Journal_Extra[2] = extra_value;
+  Journal_Busy = 1;
+
+  Save_Async(EEPROM_JOURNAL_START + JOURNAL_ADDRESS_OFFSET, Journal_Stage,
+             JOURNAL_DATA_OFFSET - JOURNAL_ADDRESS_OFFSET + count, NULL);
+  Save_Async(EEPROM_JOURNAL_START + JOURNAL_EXTRA_OFFSET, Journal_Extra, 3, NULL);
+  Save_Async(EEPROM_JOURNAL_START, &Journal_Committed, 1, NULL);
+  Save_Async(address, &Journal_Stage[JOURNAL_DATA_OFFSET - JOURNAL_ADDRESS_OFFSET], count, NULL);
+  if (extra_address != JOURNAL_NO_EXTRA)
+    Save_Async(extra_address, &Journal_Extra[2], 1, NULL);
+  Save_Async(EEPROM_JOURNAL_START, &Journal_Empty, 1, Journal_Done);
+}
+
+/**
+ * @brief Applies a committed journal transaction and releases the journal
+ * @details Replaying twice is harmless, so a brown-out during the replay
+ *          itself is recovered on the next boot. Anything but a commit
+ *          marker means the transaction never committed and is dropped.
+ */
+static void Journal_Replay(void)
+{
+  u8 state = EEPROM_vRead(EEPROM_JOURNAL_START);
+  if (state == JOURNAL_EMPTY)
+    return;
+
+  if (state == JOURNAL_COMMITTED)
+  {
+    u8 header[JOURNAL_DATA_OFFSET - JOURNAL_ADDRESS_OFFSET];
+    u8 data[JOURNAL_DATA_SIZE];
+
+    EEPROM_vReadBlock(EEPROM_JOURNAL_START + JOURNAL_ADDRESS_OFFSET, header, sizeof(header));
+    u16 address = ((u16)header[0] << 8) | header[1];
+    u8 count = header[JOURNAL_COUNT_OFFSET - JOURNAL_ADDRESS_OFFSET];
+
+    if (count <= JOURNAL_DATA_SIZE && address >= EEPROM_USER_START && address + count <= EEPROM_JOURNAL_START)
+    {
+      EEPROM_vReadBlock(EEPROM_JOURNAL_START + JOURNAL_DATA_OFFSET, data, count);
+      EEPROM_vWriteBlock(address, data, count);
+
+      EEPROM_vReadBlock(EEPROM_JOURNAL_START + JOURNAL_EXTRA_OFFSET, header, 3);
+      address = ((u16)header[0] << 8) | header[1];
+      if (address < EEPROM_JOURNAL_START)
+        EEPROM_vUpdate(address, header[2]);
+    }
+  }
+  else if (state == JOURNAL_PROMOTE)
+  {
+    u8 user_index = EEPROM_vRead(EEPROM_JOURNAL_START + JOURNAL_ADDRESS_OFFSET);
+    u16 base_addr = Get_User_Base_Address(user_index);
+
+    // The source block is freed only after the copy is complete
+    if (user_index > 0 && user_index < MAX_USERS &&
+        EEPROM_vRead(base_addr + USER_NAME_LENGTH_OFFSET) != USER_SLOT_FREE)
+    {
+      u8 block[USER_BLOCK_SIZE];
+      EEPROM_vReadBlock(base_addr, block, USER_BLOCK_SIZE);
+      EEPROM_vWriteBlock(EEPROM_USER_START, block, USER_BLOCK_SIZE);
+      EEPROM_vUpdate(base_addr + USER_NAME_LENGTH_OFFSET, USER_SLOT_FREE);
+    }
+  }
+
+  EEPROM_vUpdate(EEPROM_JOURNAL_START, JOURNAL_EMPTY);
+}
+
+/**
+ * @brief Moves a user block into block 0 and frees it as one transaction
+ * @param user_index Index of the user block to move
+ * @details Runs in the foreground, the RAM directory and index are left to the caller
+ */
+static void Journal_Promote(u8 user_index)
+{
+  while (Journal_Busy)
+    ;
+  EEPROM_vUpdate(EEPROM_JOURNAL_START + JOURNAL_ADDRESS_OFFSET, user_index);
+  EEPROM_vUpdate(EEPROM_JOURNAL_START, JOURNAL_PROMOTE);
+  Journal_Replay();
+}
+
+/**
+ * @brief Loads the failed-login counter ring and finds its newest cell
+ * @return Stored tries value, NOTPRESSED if no failed login is pending
+ */
+static u8 Tries_Ring_Load(void)
+{
+  EEPROM_vReadBlock(EEPROM_TRIES_RING_START, Tries_Ring, TRIES_RING_SIZE);
+
+  u8 phase = Tries_Ring[0] & TRIES_RING_PHASE;
+  Tries_Ring_Head = 1;
+  while (Tries_Ring_Head < TRIES_RING_SIZE && (Tries_Ring[Tries_Ring_Head] & TRIES_RING_PHASE) == phase)
+  {
+    Tries_Ring_Head++;
+  }
+
+  u8 value = Tries_Ring[Tries_Ring_Head - 1] & ~TRIES_RING_PHASE;
+  if (Tries_Ring_Head == TRIES_RING_SIZE)
+    Tries_Ring_Head = 0; // Lap complete, the next update starts a new pass
+  return (value == TRIES_RING_EMPTY) ? NOTPRESSED : value;
+}
+
+/**
+ * @brief Stores the tries value in the next ring cell
+ * @param value Tries left, NOTPRESSED to clear
+ * @details Programs a single byte in the background, nothing if the value is unchanged
+ */
+static void Tries_Ring_Save(u8 value)
+{
+  u8 last = (Tries_Ring_Head == 0) ? TRIES_RING_SIZE - 1 : Tries_Ring_Head - 1;
+  u8 cell = (value == NOTPRESSED) ? TRIES_RING_EMPTY : value;
+
+  if ((Tries_Ring[last] & ~TRIES_RING_PHASE) == cell)
+    return;
+
+  u8 phase = Tries_Ring[last] & TRIES_RING_PHASE;
+  if (Tries_Ring_Head == 0)
+    phase ^= TRIES_RING_PHASE;
+  Tries_Ring[Tries_Ring_Head] = phase | cell;
+  Save_Async(EEPROM_TRIES_RING_START + Tries_Ring_Head, &Tries_Ring[Tries_Ring_Head], 1, NULL);
+  Tries_Ring_Head = (Tries_Ring_Head + 1) % TRIES_RING_SIZE;
+}
+
+/**
+ * @brief Computes the short fingerprint stored in the user directory
+ * @param username Username to hash
+ * @param length Length of the username
+ * @return 8-bit fingerprint of the username
+ */
+static u8 Hash_Username(u8 *username, u8 length)
+{
+  u8 hash = length;
+  for (u8 i = 0; i < length; i++)
+  {
+    hash = (hash << 5) + hash + username[i]; // hash * 33 + c
+  }
+  return hash;
+}
+
+/**
+ * @brief Checks whether a user block holds a registered user
+ * @param user_index Index of the user block
+ * @return true if the block is in use, false if free or out of range
+ */
+static bool Is_Slot_Used(u8 user_index)
+{
+  return (user_index < MAX_USERS) && (Directory_Length[user_index] != USER_SLOT_FREE);
+}
+
+/**
+ * @brief Updates the directory entry of a user block
+ * @param user_index Index of the user
+ * @param username Username stored in the block
+ * @param length Length of the username
+ */
+static void Directory_Update(u8 user_index, u8 *username, u8 length)
+{
+  Directory_Length[user_index] = length;
+  Directory_Hash[user_index] = Hash_Username(username, length);
+}
+
+/**
+ * @brief Compares a username against the one stored in EEPROM
+ * @param user_index Index of the user
+ * @param username Username to compare
+ * @param length Length of the username
+ * @return true if the stored username matches, false otherwise
+ */
+static bool Is_Stored_Username(u8 user_index, u8 *username, u8 length)
+{
+  u8 stored[USERNAME_MAX_LENGTH];
+
+  EEPROM_vReadBlock(Get_User_Base_Address(user_index) + USER_NAME_START_OFFSET, stored, length);
+  for (u8 i = 0; i < length; i++)
+  {
+    if (stored[i] != username[i])
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Gets the home bucket of a user in the hash index
+ * @param user_index Index of the user
+ * @return Bucket the user's probe sequence starts at
+ */
+static u8 Index_Home(u8 user_index)
+{
+  return Directory_Hash[user_index] & (INDEX_SIZE - 1);
+}
+
+/**
+ * @brief Writes one hash index bucket to RAM and EEPROM
+ * @param bucket Bucket to write
+ * @param value User index to store, INDEX_EMPTY to free the bucket
+ */
+static void Index_Write_Entry(u8 bucket, u8 value)
+{
+  Index_Check ^= Index_Table[bucket] ^ value;
+  Index_Table[bucket] = value;
+  Save_Async(EEPROM_INDEX_START + bucket, &Index_Table[bucket], 1, NULL);
+  Save_Async(EEPROM_INDEX_CHECK_LOCATION, &Index_Check, 1, NULL);
+}
+
+/**
+ * @brief Finds the bucket holding a user
+ * @param user_index Index of the user
+ * @return Bucket of the user, INDEX_EMPTY if the user is not indexed
+ */
+static u8 Index_Find_Bucket(u8 user_index)
+{
+  u8 bucket = Index_Home(user_index);
+  for (u8 n = 0; n < INDEX_SIZE; n++)
+  {
+    if (Index_Table[bucket] == user_index)
+      return bucket;
+    if (Index_Table[bucket] == INDEX_EMPTY)
+      break;
+    bucket = (bucket + 1) & (INDEX_SIZE - 1);
+  }
+  return INDEX_EMPTY;
+}
+
+/**
+ * @brief Adds a user to the hash index
+ * @param user_index Index of the user, its directory entry must be up to date
+ */
+static void Index_Insert(u8 user_index)
+{
+  u8 bucket = Index_Home(user_index);
+  while (Index_Table[bucket] != INDEX_EMPTY)
+  {
+    bucket = (bucket + 1) & (INDEX_SIZE - 1); // INDEX_SIZE > MAX_USERS, a free bucket always exists
+  }
+  Index_Write_Entry(bucket, user_index);
+}
+
+/**
+ * @brief Removes a user from the hash index
+ * @param user_index Index of the user, its directory entry must still hold the old name
+ * @details Uses backward-shift deletion so no tombstones are left in the probe sequences
+ */
+static void Index_Remove(u8 user_index)
+{
+  u8 hole = Index_Find_Bucket(user_index);
+  if (hole == INDEX_EMPTY)
+    return;
+
+  u8 bucket = hole;
+  while (1)
+  {
+    bucket = (bucket + 1) & (INDEX_SIZE - 1);
+    if (Index_Table[bucket] == INDEX_EMPTY)
+      break;
+
+    // Move the entry back if the hole lies between its home bucket and its current bucket
+    u8 home = Index_Home(Index_Table[bucket]);
+    if (((bucket - home) & (INDEX_SIZE - 1)) >= ((bucket - hole) & (INDEX_SIZE - 1)))
+    {
+      Index_Write_Entry(hole, Index_Table[bucket]);
+      hole = bucket;
+    }
+  }
+  Index_Write_Entry(hole, INDEX_EMPTY);
+}
+
+/**
+ * @brief Rebuilds the hash index from the user directory
+ * @details Used when the stored index fails its consistency checks
+ */
+static void Index_Rebuild(void)
+{
+  for (u8 b = 0; b < INDEX_SIZE; b++)
+  {
+    Index_Table[b] = INDEX_EMPTY;
+  }
+
+  for (u8 i = 0; i < MAX_USERS; i++)
+  {
+    if (!Is_Slot_Used(i))
+      continue;
+
+    u8 bucket = Index_Home(i);
+    while (Index_Table[bucket] != INDEX_EMPTY)
+    {
+      bucket = (bucket + 1) & (INDEX_SIZE - 1);
+    }
+    Index_Table[bucket] = i;
+  }
+
+  Index_Check = 0xFF;
+  for (u8 b = 0; b < INDEX_SIZE; b++)
+  {
+    Index_Check ^= Index_Table[b];
+  }
+  EEPROM_vWriteBlock(EEPROM_INDEX_START, Index_Table, INDEX_SIZE);
+  EEPROM_vUpdate(EEPROM_INDEX_CHECK_LOCATION, Index_Check);
+}
+
+/**
+ * @brief Loads the hash index from EEPROM
+ * @details The index is rebuilt if the check byte is wrong, an entry points
+ *          to a free block or any user cannot be reached through it
+ */
+static void Index_Load(void)
+{
+  u8 check = 0xFF; // Check byte of an erased (all empty) table
+  u8 entries = 0;
+  bool valid = true;
+
+  EEPROM_vReadBlock(EEPROM_INDEX_START, Index_Table, INDEX_SIZE);
+  for (u8 b = 0; b < INDEX_SIZE; b++)
+  {
+    check ^= Index_Table[b];
+
+    if (Index_Table[b] != INDEX_EMPTY)
+    {
+      if (!Is_Slot_Used(Index_Table[b]))
+        valid = false;
+      entries++;
+    }
+  }
+  Index_Check = EEPROM_vRead(EEPROM_INDEX_CHECK_LOCATION);
+
+  if (check != Index_Check || entries != User_Count)
+    valid = false;
+
+  for (u8 i = 0; valid && i < MAX_USERS; i++)
+  {
+    if (Is_Slot_Used(i) && Index_Find_Bucket(i) == INDEX_EMPTY)
+      valid = false;
+  }
+
+  if (!valid)
+    Index_Rebuild();
+}
+
+/**
+ * @brief Looks up a username through the hash index
+ * @param username Username to find
+ * @param length Length of the username
+ * @param skip_index User index to ignore (USER_NOT_FOUND to check all users)
+ * @return Index of the matching user, USER_NOT_FOUND if none
+ * @details Only users whose length and fingerprint match are read back from EEPROM
+ */
+static u8 Find_User(u8 *username, u8 length, u8 skip_index)
+{
+  u8 hash = Hash_Username(username, length);
+  u8 bucket = hash & (INDEX_SIZE - 1);
+
+  for (u8 n = 0; n < INDEX_SIZE; n++)
+  {
+    u8 user_index = Index_Table[bucket];
+    if (user_index == INDEX_EMPTY)
+      break;
+
+    if (user_index != skip_index && Directory_Length[user_index] == length &&
+        Directory_Hash[user_index] == hash && Is_Stored_Username(user_index, username, length))
+      return user_index;
+
+    bucket = (bucket + 1) & (INDEX_SIZE - 1);
+  }
+  return USER_NOT_FOUND;
+}
+
+/**
+ * @brief Loads the user directory and the free block list from EEPROM
+ * @details Called once at startup, every later update goes through Write_Username
+ *          and Free_Slot. User_Count is recounted from the block status bytes.
+ */
+static void Directory_Load(void)
+{
+  u8 username[21];
+
+  User_Count = 0;
+  Free_Count = 0;
+
+  for (u8 i = MAX_USERS; i > 0; i--)
+  {
+    u8 slot = i - 1; // Walk down so the lowest free block ends on top of the stack
+    u16 base_addr = Get_User_Base_Address(slot);
+    u8 length = EEPROM_vRead(base_addr + USER_NAME_LENGTH_OFFSET);
+
+    if (length == USER_SLOT_FREE)
+    {
+      Directory_Length[slot] = USER_SLOT_FREE;
+      Free_Slots[Free_Count++] = slot;
+      continue;
+    }
+
+    if (length > USERNAME_MAX_LENGTH)
+      length = 0; // Corrupted block, never matches
+
+    EEPROM_vReadBlock(base_addr + USER_NAME_START_OFFSET, username, length);
+    Directory_Update(slot, username, length);
+    User_Count++;
+  }
+}
+
+/**
+ * @brief Computes the stored digest of a password
+ * @param password Password characters
+ * @param length Length of the password
+ * @param digest Buffer for the PASSWORD_DIGEST_SIZE digest bytes
+ * @details 32-bit FNV-1a, so only a fixed-size fingerprint of the password
+ *          is kept in EEPROM
+ */
+static void Password_Digest(const u8 *password, u8 length, u8 *digest)
+{
+  u32 hash = 0x811C9DC5UL;
+  for (u8 i = 0; i < length; i++)
+  {
+    hash ^= password[i];
+    hash *= 0x01000193UL;
+  }
+  for (u8 i = 0; i < PASSWORD_DIGEST_SIZE; i++)
+  {
+    digest[i] = (u8)hash;
+    hash >>= 8;
+  }
+}
+
+/**
+ * @brief Computes the CRC of a user record
+ * @param name_field Username field, [length][characters]
+ * @param digest Password digest
+ * @return CRC-8 over the used username characters and the digest
+ */
+static u8 Record_Crc(const u8 *name_field, const u8 *digest)
+{
+  u8 crc = CRC_u8Calc8(CRC8_INIT, name_field, name_field[0] + 1);
+  return CRC_u8Calc8(crc, digest, PASSWORD_DIGEST_SIZE);
+}
+
+/**
+ * @brief Reads the [length][characters] username field of a user block
+ * @param user_index Index of the user
+ * @param field Buffer of USERNAME_MAX_LENGTH + 1 bytes, a bad length reads as empty
+ */
+static void Read_Name_Field(u8 user_index, u8 *field)
+{
+  EEPROM_vReadBlock(Get_User_Base_Address(user_index) + USER_NAME_LENGTH_OFFSET, field, USERNAME_MAX_LENGTH + 1);
+  if (field[0] > USERNAME_MAX_LENGTH)
+    field[0] = 0;
+}
+
+/**
+ * @brief Checks every used user block against its stored CRC
+ * @details Sets Bad_Records, one block read and a nibble-table CRC per user
+ */
+static void Records_Verify(void)
+{
+  u8 block[USER_BLOCK_SIZE];
+
+  Bad_Records = 0;
+  for (u8 i = 0; i < MAX_USERS; i++)
+  {
+    if (!Is_Slot_Used(i))
+      continue;
+
+    EEPROM_vReadBlock(Get_User_Base_Address(i), block, USER_BLOCK_SIZE);
+    if (block[USER_NAME_LENGTH_OFFSET] > USERNAME_MAX_LENGTH ||
+        Record_Crc(&block[USER_NAME_LENGTH_OFFSET], &block[USER_DIGEST_OFFSET]) != block[USER_CRC_OFFSET])
+    {
+      Bad_Records++;
+    }
+  }
+}
+
+/**
+ * @brief Builds the password digest and the CRC of an old 42 byte block
+ * @param old_addr EEPROM address of the old block
+ * @param field Username field the record gets, [length][characters]
+ * @param record Buffer for [digest][crc]
+ */
+static void Old_Block_Record(u16 old_addr, const u8 *field, u8 *record)
+{
+  u8 password[PASSWORD_MAX_LENGTH + 1]; // [length][characters]
+
+  EEPROM_vReadBlock(old_addr + OLD_USER_PASS_LENGTH_OFFSET, password, PASSWORD_MAX_LENGTH + 1);
+  if (password[0] > PASSWORD_MAX_LENGTH)
+    password[0] = 0;
+  Password_Digest(&password[1], password[0], record);
+  record[PASSWORD_DIGEST_SIZE] = Record_Crc(field, record);
+}
+
+/**
+ * @brief Copies the last block of the original layout out of the journal area
+ * @details That block starts at EEPROM_JOURNAL_START, so it is converted to a
+ *          digest record at EEPROM_STAGE_START before the journal is first
+ *          written and Migrate_Old_Blocks takes it from there. The journal
+ *          release then frees its length byte, so a boot that finds it free
+ *          with all OLD_USER_BLOCKS users stored has staged it already.
+ */
+static void Stage_Last_Block(void)
+{
+  u16 old_addr = EEPROM_USER_START + ((OLD_USER_BLOCKS - 1) * OLD_USER_BLOCK_SIZE);
+  u8 block[USER_BLOCK_SIZE];
+
+  EEPROM_vReadBlock(old_addr + USER_NAME_LENGTH_OFFSET, block, USERNAME_MAX_LENGTH + 1);
+  if (User_Count >= OLD_USER_BLOCKS && block[0] == USER_SLOT_FREE)
+    return; // Staged by a boot cut short
+
+  if (User_Count < OLD_USER_BLOCKS || block[0] > USERNAME_MAX_LENGTH)
+  {
+    EEPROM_vUpdate(EEPROM_STAGE_START + USER_NAME_LENGTH_OFFSET, USER_SLOT_FREE); // No user to keep
+    return;
+  }
+
+  Old_Block_Record(old_addr, block, &block[USER_DIGEST_OFFSET]);
+  EEPROM_vWriteBlock(EEPROM_STAGE_START, block, USER_BLOCK_SIZE);
+}
+
+/**
+ * @brief Converts the 42 byte blocks of the original layout into digest records
+ * @details Old block i becomes block i in two steps, the username field and
+ *          then the password digest with the CRC. Each step is one journal
+ *          transaction that also stores the next step at
+ *          EEPROM_MIGRATION_PROGRESS, so a reset resumes where it stopped.
+ *          Blocks only shrink, so no step overwrites old bytes a later step
+ *          still has to read. The last old block is taken from the copy
+ *          Stage_Last_Block made. The progress is released by the caller
+ *          once the new layout version is stored.
+ */
+static void Migrate_Old_Blocks(void)
+{
+  u8 field[USERNAME_MAX_LENGTH + 1];
+
+  for (u8 step = EEPROM_vRead(EEPROM_MIGRATION_PROGRESS); step < 2 * OLD_USER_BLOCKS; step++)
+  {
+    u8 i = step / 2;
+    u16 old_addr = EEPROM_USER_START + (i * OLD_USER_BLOCK_SIZE);
+    bool staged = (i == OLD_USER_BLOCKS - 1);
+
+    if ((step & 1) == 0)
+    {
+      EEPROM_vReadBlock((staged ? EEPROM_STAGE_START : old_addr) + USER_NAME_LENGTH_OFFSET, field,
+                        USERNAME_MAX_LENGTH + 1);
+      if (field[0] > USERNAME_MAX_LENGTH)
+      {
+        field[0] = USER_SLOT_FREE; // Free or unreadable, no password to move
+        step++;
+      }
+      Journal_Write(Get_User_Base_Address(i) + USER_NAME_LENGTH_OFFSET, field,
+                    (field[0] == USER_SLOT_FREE) ? 1 : field[0] + 1, EEPROM_MIGRATION_PROGRESS, step + 1);
+    }
+    else
+    {
+      u8 record[PASSWORD_DIGEST_SIZE + 1]; // [digest][crc]
+
+      if (staged)
+      {
+        EEPROM_vReadBlock(EEPROM_STAGE_START + USER_DIGEST_OFFSET, record, sizeof(record));
+      }
+      else
+      {
+        Read_Name_Field(i, field);
+        Old_Block_Record(old_addr, field, record);
+      }
+      Journal_Write(Get_User_Base_Address(i) + USER_DIGEST_OFFSET, record, sizeof(record),
+                    EEPROM_MIGRATION_PROGRESS, step + 1);
+    }
+  }
+
+  /* Blocks past the old ones start out free */
+  for (u8 i = OLD_USER_BLOCKS; i < MAX_USERS; i++)
+  {
+    EEPROM_vUpdate(Get_User_Base_Address(i) + USER_NAME_LENGTH_OFFSET, USER_SLOT_FREE);
+  }
+}
+
+/**
+ * @brief Takes the next menu key from the USART without waiting
+ * @param key Pointer to store the key
+ * @return OK if a key was read, NOK otherwise
+ * @details Host frames are answered first, so their bytes are never taken for keys
+ */
+static u8 Menu_Key_Poll(volatile u8 *key)
+{
+  u8 byte;
+
+  if (HOST_u8Poll() != NOK || USART_u8GetChar(&byte) != OK)
+    return NOK;
+  *key = byte;
+  return OK;
+}
+
 /**
  * @brief Reads a username from EEPROM
  * @param user_index Index of the user to read
@@ -58,10 +771,9 @@ static void Read_Username(u8 user_index, volatile u8 *username, volatile u8 *len
 {
   u16 base_addr = Get_User_Base_Address(user_index);
   *length = EEPROM_vRead(base_addr + USER_NAME_LENGTH_OFFSET);
-  for (u8 i = 0; i < *length; i++)
-  {
-    username[i] = EEPROM_vRead(base_addr + USER_NAME_START_OFFSET + i);
-  }
+  if (*length > USERNAME_MAX_LENGTH)
+    *length = 0;
+  EEPROM_vReadBlock(base_addr + USER_NAME_START_OFFSET, (u8 *)username, *length);
   username[*length] = '\0';
 }
 
@@ -70,48 +782,147 @@ static void Read_Username(u8 user_index, volatile u8 *username, volatile u8 *len
  * @param user_index Index of the user to write
  * @param username Username to store
  * @param length Length of the username
+ * @details The length byte doubles as the block status, so a free block
+ *          becomes used once this write lands. The write goes through the
+ *          journal and finishes in the background.
  */
 static void Write_Username(u8 user_index, u8 *username, u8 length)
 {
+  u8 field[USERNAME_MAX_LENGTH + 1];
+  u8 digest[PASSWORD_DIGEST_SIZE];
   u16 base_addr = Get_User_Base_Address(user_index);
-  EEPROM_vWrite(base_addr + USER_NAME_LENGTH_OFFSET, length);
+
+  if (Is_Slot_Used(user_index))
+    Index_Remove(user_index); // Drop the old name from the index
+
+  field[0] = length;
   for (u8 i = 0; i < length; i++)
   {
-    EEPROM_vWrite(base_addr + USER_NAME_START_OFFSET + i, username[i]);
+    field[1 + i] = username[i];
+  }
+  EEPROM_vReadBlock(base_addr + USER_DIGEST_OFFSET, digest, PASSWORD_DIGEST_SIZE);
+  Journal_Write(base_addr + USER_NAME_LENGTH_OFFSET, field, length + 1,
+                base_addr + USER_CRC_OFFSET, Record_Crc(field, digest));
+
+  Directory_Update(user_index, username, length);
+  Index_Insert(user_index);
+}
+
+/**
+ * @brief Checks a password against the digest stored for a user
+ * @param user_index Index of the user
+ * @param password Password to check
+ * @param length Length of the password
+ * @return true if the digests match, false otherwise
+ */
+static bool Is_Password_Match(u8 user_index, const u8 *password, u8 length)
+{
+  u8 stored[PASSWORD_DIGEST_SIZE];
+  u8 digest[PASSWORD_DIGEST_SIZE];
+
+  EEPROM_vReadBlock(Get_User_Base_Address(user_index) + USER_DIGEST_OFFSET, stored, PASSWORD_DIGEST_SIZE);
+  Password_Digest(password, length, digest);
+  for (u8 i = 0; i < PASSWORD_DIGEST_SIZE; i++)
+  {
+    if (stored[i] != digest[i])
+      return false;
   }
+  return true;
 }
 
 /**
- * @brief Reads a password from EEPROM
+ * @brief Writes a password to EEPROM
  * @param user_index Index of the user
- * @param password Buffer to store the password
- * @param length Pointer to store password length
+ * @param password Password to store
+ * @param length Length of the password
+ * @details Only the digest is stored, together with the new record CRC.
+ *          The write goes through the journal and finishes in the background.
+ */
+static void Write_Password(u8 user_index, u8 *password, u8 length)
+{
+  u8 record[PASSWORD_DIGEST_SIZE + 1]; // [digest][crc]
+  u8 name_field[USERNAME_MAX_LENGTH + 1];
+
+  Password_Digest(password, length, record);
+  Read_Name_Field(user_index, name_field);
+  record[PASSWORD_DIGEST_SIZE] = Record_Crc(name_field, record);
+  Journal_Write(Get_User_Base_Address(user_index) + USER_DIGEST_OFFSET, record, sizeof(record),
+                JOURNAL_NO_EXTRA, 0);
+}
+
+/**
+ * @brief Marks a user block as free
+ * @param user_index Index of the user block
+ * @details Costs a single status byte write, the stale name and password
+ *          stay in EEPROM until the block is reused
+ */
+static void Free_Slot(u8 user_index)
+{
+  Index_Remove(user_index);
+  Save_Async(Get_User_Base_Address(user_index) + USER_NAME_LENGTH_OFFSET, &Slot_Free_Status, 1, NULL);
+  Directory_Length[user_index] = USER_SLOT_FREE;
+
+  // Keep the lowest free block on top
+  u8 pos = Free_Count++;
+  while (pos > 0 && Free_Slots[pos - 1] < user_index)
+  {
+    Free_Slots[pos] = Free_Slots[pos - 1];
+    pos--;
+  }
+  Free_Slots[pos] = user_index;
+}
+
+/**
+ * @brief Removes a user from the system
+ * @param user_index Index of the user to remove
+ * @details Block 0 always holds the admin. When the admin is removed the
+ *          next used block is moved into block 0 as one journaled
+ *          transaction, every other removal only flips the block status.
  */
-static void Read_Password(u8 user_index, u8 *password, u8 *length)
+static void Remove_User(u8 user_index)
 {
-  u16 base_addr = Get_User_Base_Address(user_index);
-  *length = EEPROM_vRead(base_addr + USER_PASS_LENGTH_OFFSET);
-  for (u8 i = 0; i < *length; i++)
+  if (user_index == 0)
   {
-    password[i] = EEPROM_vRead(base_addr + USER_PASS_START_OFFSET + i);
+    for (u8 i = 1; i < MAX_USERS; i++)
+    {
+      if (Is_Slot_Used(i))
+      {
+        Journal_Promote(i);
+
+        Index_Remove(0);
+        Directory_Length[0] = Directory_Length[i];
+        Directory_Hash[0] = Directory_Hash[i];
+        Index_Insert(0);
+
+        user_index = i; // Promoted user's old block is the one to free
+        break;
+      }
+    }
   }
-  password[*length] = '\0';
+
+  Free_Slot(user_index);
+  User_Count--;
+  Save_Async(EEPROM_UserCount_Location, (const u8 *)&User_Count, 1, NULL);
 }
 
 /**
- * @brief Writes a password to EEPROM
- * @param user_index Index of the user
+ * @brief Stores a new user in the lowest free block
+ * @param username Username to store
+ * @param username_length Length of the username
  * @param password Password to store
- * @param length Length of the password
+ * @param password_length Length of the password
+ * @return Index of the new user
+ * @details The caller checks that a block is free, the username goes last
+ *          since it marks the block used
  */
-static void Write_Password(u8 user_index, u8 *password, u8 length)
+static u8 Store_New_User(u8 *username, u8 username_length, u8 *password, u8 password_length)
 {
-  u16 base_addr = Get_User_Base_Address(user_index);
-  EEPROM_vWrite(base_addr + USER_PASS_LENGTH_OFFSET, length);
-  for (u8 i = 0; i < length; i++)
-  {
-    EEPROM_vWrite(base_addr + USER_PASS_START_OFFSET + i, password[i]);
-  }
+  u8 user_index = Free_Slots[--Free_Count];
+  Write_Password(user_index, password, password_length);
+  Write_Username(user_index, username, username_length);
+  User_Count++;
+  Save_Async(EEPROM_UserCount_Location, (const u8 *)&User_Count, 1, NULL);
+  return user_index;
 }
 
 /**
@@ -165,29 +976,8 @@ bool Is_Password_Valid(u8 *password, u8 length)
  */
 bool Is_Username_Exists(u8 *username, u8 length)
 {
-  u8 stored_username[21];
-  u8 stored_length;
-
-  for (u8 i = 0; i < User_Count; i++)
-  {
-    if (i == Current_User)
-      continue; // Skip current user when changing username
-
-    Read_Username(i, stored_username, &stored_length);
-
-    u8 match = 1;
-    for (u8 j = 0; j < length; j++)
-    {
-      if (username[j] != stored_username[j])
-      {
-        match = 0;
-        break;
-      }
-    }
-    if (match)
-      return true;
-  }
-  return false;
+  // Skip current user when changing username
+  return Find_User(username, length, Current_User) != USER_NOT_FOUND;
 }
 
 /**
@@ -197,28 +987,30 @@ bool Is_Username_Exists(u8 *username, u8 length)
  */
 void Log_Event(u8 event_type, u8 user_index)
 {
+  CLCD_vBeginFrame();
   CLCD_vClearScreen();
   switch (event_type)
   {
   case EVENT_LOGIN_SUCCESS:
-    CLCD_vSendString((u8 *)"Login: Success");
+    MSG_vShow(MSG_LOGIN_SUCCESS);
     break;
   case EVENT_LOGIN_FAIL:
-    CLCD_vSendString((u8 *)"Login: Failed");
+    MSG_vShow(MSG_LOGIN_FAILED);
     break;
   case EVENT_PASS_CHANGE:
-    CLCD_vSendString((u8 *)"Pass Changed");
+    MSG_vShow(MSG_PASS_CHANGED);
     break;
   case EVENT_USER_CHANGE:
-    CLCD_vSendString((u8 *)"User Changed");
+    MSG_vShow(MSG_USER_CHANGED);
     break;
   case EVENT_USER_DELETE:
-    CLCD_vSendString((u8 *)"User Deleted");
+    MSG_vShow(MSG_USER_DELETED);
     break;
   case EVENT_USER_CREATE:
-    CLCD_vSendString((u8 *)"User Created");
+    MSG_vShow(MSG_USER_CREATED);
     break;
   }
+  CLCD_vEndFrame();
   _delay_ms(1000);
 }
 
@@ -233,50 +1025,22 @@ void Log_Event(u8 event_type, u8 user_index)
 void Change_Username(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"New Username:");
+  MSG_vShow(MSG_NEW_USERNAME);
   CLCD_vSetPosition(2, 1);
 
   u8 new_username[21];
   u8 new_length = 0;
   do
   {
-    while (1)
-    {
-      Error_State = USART_u8ReceiveData(&KPD_Press);
-      if (Error_State == OK)
-      {
-        if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-        { // Enter
-          if (new_length >= USERNAME_MIN_LENGTH)
-            break;
-        }
-        else if (KPD_Press == 0x08)
-        { // Backspace
-          if (new_length > 0)
-          {
-            new_length--;
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-            CLCD_vSendData(' ');
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-          }
-        }
-        else if (new_length < USERNAME_MAX_LENGTH)
-        {
-          new_username[new_length++] = KPD_Press;
-          CLCD_vSendData(KPD_Press);
-        }
-      }
-    }
-
-    new_username[new_length] = '\0';
+    new_length = LINE_u8Read(new_username, USERNAME_MIN_LENGTH, USERNAME_MAX_LENGTH, LINE_ECHO_PLAIN);
 
     if (Is_Username_Exists(new_username, new_length))
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Username exists!");
+      MSG_vShow(MSG_USERNAME_EXISTS);
       _delay_ms(1000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"New Username:");
+      MSG_vShow(MSG_NEW_USERNAME);
       CLCD_vSetPosition(2, 1);
     }
   } while (Is_Username_Exists(new_username, new_length));
@@ -305,7 +1069,7 @@ void Change_Password(void)
 {
   u8 password_flag = 1;
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Current Pass:");
+  MSG_vShow(MSG_CURRENT_PASS);
   CLCD_vSetPosition(2, 1);
 
   // First verify current password
@@ -314,117 +1078,41 @@ void Change_Password(void)
   do
   {
     password_flag = 1;
-    while (1)
-    {
-      Error_State = USART_u8ReceiveData(&KPD_Press);
-      if (Error_State == OK)
-      {
-        if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-          break;
-        else if (KPD_Press == 0x08)
-        {
-          if (pass_length > 0)
-          {
-            pass_length--;
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-            CLCD_vSendData(' ');
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-          }
-        }
-        else if (pass_length < PASSWORD_MAX_LENGTH)
-        {
-          temp_pass[pass_length++] = KPD_Press;
-          CLCD_vSendData(KPD_Press);
-          _delay_ms(200);
-          Clear_Char();
-          CLCD_vSendData('*');
-        }
-      }
-    }
+    pass_length = LINE_u8Read(temp_pass, 0, PASSWORD_MAX_LENGTH, LINE_ECHO_MASK);
 
-    u8 stored_pass[21];
-    u8 stored_length;
-    Read_Password(Current_User, stored_pass, &stored_length);
-
-    if (pass_length != stored_length)
+    if (!Is_Password_Match(Current_User, temp_pass, pass_length))
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Wrong Password!");
+      MSG_vShow(MSG_WRONG_PASSWORD);
       password_flag = 0;
       _delay_ms(1000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Current Pass:");
+      MSG_vShow(MSG_CURRENT_PASS);
       CLCD_vSetPosition(2, 1);
     }
-    else
-    {
-      for (u8 i = 0; i < pass_length; i++)
-      {
-        if (temp_pass[i] != stored_pass[i])
-        {
-          CLCD_vClearScreen();
-          CLCD_vSendString((u8 *)"Wrong Password!");
-          password_flag = 0;
-          _delay_ms(1000);
-          CLCD_vClearScreen();
-          CLCD_vSendString((u8 *)"Current Pass:");
-          CLCD_vSetPosition(2, 1);
-        }
-      }
-    }
   } while (password_flag == 0);
   // Get new password
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"New Password:");
+  MSG_vShow(MSG_NEW_PASSWORD);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"Min len: ");
+  MSG_vShow(MSG_MIN_LEN);
   CLCD_vSendIntNumber(PASSWORD_MIN_LENGTH);
 
   do
   {
-    pass_length = 0;
-    while (1)
-    {
-      Error_State = USART_u8ReceiveData(&KPD_Press);
-      if (Error_State == OK)
-      {
-        if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-        {
-          if (pass_length >= PASSWORD_MIN_LENGTH)
-            break;
-        }
-        else if (KPD_Press == 0x08)
-        {
-          if (pass_length > 0)
-          {
-            pass_length--;
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-            CLCD_vSendData(' ');
-            CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-          }
-        }
-        else if (pass_length < PASSWORD_MAX_LENGTH)
-        {
-          temp_pass[pass_length++] = KPD_Press;
-          CLCD_vSendData(KPD_Press);
-          _delay_ms(200);
-          Clear_Char();
-          CLCD_vSendData('*');
-        }
-      }
-    }
+    pass_length = LINE_u8Read(temp_pass, PASSWORD_MIN_LENGTH, PASSWORD_MAX_LENGTH, LINE_ECHO_MASK);
 
     if (!Is_Password_Valid(temp_pass, pass_length))
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Weak Password!");
+      MSG_vShow(MSG_WEAK_PASSWORD);
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Need: A,a,1,@");
+      MSG_vShow(MSG_PASSWORD_RULES);
       _delay_ms(2000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"New Password:");
+      MSG_vShow(MSG_NEW_PASSWORD);
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Min len: ");
+      MSG_vShow(MSG_MIN_LEN);
       CLCD_vSendIntNumber(PASSWORD_MIN_LENGTH);
     }
   } while (!Is_Password_Valid(temp_pass, pass_length));
@@ -443,78 +1131,23 @@ void Change_Password(void)
 bool Delete_User(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Enter Pass to");
+  MSG_vShow(MSG_ENTER_PASS_TO);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"Delete Account");
+  MSG_vShow(MSG_DELETE_ACCOUNT);
   CLCD_vSetPosition(3, 1);
 
   u8 temp_pass[21];
-  u8 pass_length = 0;
-
-  while (1)
-  {
-    Error_State = USART_u8ReceiveData(&KPD_Press);
-    if (Error_State == OK)
-    {
-      if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-        break;
-      else if (KPD_Press == 0x08)
-      {
-        if (pass_length > 0)
-        {
-          pass_length--;
-          CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-          CLCD_vSendData(' ');
-          CLCD_vSendCommand(CLCD_SHIFT_CURSOR_LEFT);
-        }
-      }
-      else if (pass_length < PASSWORD_MAX_LENGTH)
-      {
-        temp_pass[pass_length++] = KPD_Press;
-        CLCD_vSendData('*');
-      }
-    }
-  }
+  u8 pass_length = LINE_u8Read(temp_pass, 0, PASSWORD_MAX_LENGTH, LINE_ECHO_HIDDEN);
 
-  u8 stored_pass[21];
-  u8 stored_length;
-  Read_Password(Current_User, stored_pass, &stored_length);
-
-  if (pass_length != stored_length)
+  if (!Is_Password_Match(Current_User, temp_pass, pass_length))
   {
     CLCD_vClearScreen();
-    CLCD_vSendString((u8 *)"Wrong Password!");
+    MSG_vShow(MSG_WRONG_PASSWORD);
     _delay_ms(1000);
-    return 0;
-  }
-
-  for (u8 i = 0; i < pass_length; i++)
-  {
-    if (temp_pass[i] != stored_pass[i])
-    {
-      CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Wrong Password!");
-      _delay_ms(1000);
-      return false;
-    }
-  }
-
-  // Move all users after current user one position back
-  for (u8 i = Current_User; i < User_Count - 1; i++)
-  {
-    u8 next_user = i + 1;
-    u8 username[21], password[21];
-    u8 uname_len, pass_len;
-
-    Read_Username(next_user, username, &uname_len);
-    Read_Password(next_user, password, &pass_len);
-
-    Write_Username(i, username, uname_len);
-    Write_Password(i, password, pass_len);
+    return false;
   }
 
-  User_Count--;
-  EEPROM_vWrite(EEPROM_UserCount_Location, User_Count);
+  Remove_User(Current_User);
 
   Log_Event(EVENT_USER_DELETE, Current_User);
   return true;
@@ -529,25 +1162,10 @@ bool Delete_User(void)
  */
 void Delete_User_By_Admin(u8 user_index)
 {
-  if (!Is_Admin || user_index >= User_Count)
+  if (!Is_Admin || !Is_Slot_Used(user_index))
     return;
 
-  // Move all users after deleted user one position back
-  for (u8 i = user_index; i < User_Count - 1; i++)
-  {
-    u8 next_user = i + 1;
-    u8 username[21], password[21];
-    u8 uname_len, pass_len;
-
-    Read_Username(next_user, username, &uname_len);
-    Read_Password(next_user, password, &pass_len);
-
-    Write_Username(i, username, uname_len);
-    Write_Password(i, password, pass_len);
-  }
-
-  User_Count--;
-  EEPROM_vWrite(EEPROM_UserCount_Location, User_Count);
+  Remove_User(user_index);
 
   Log_Event(EVENT_USER_DELETE, user_index);
 }
@@ -564,28 +1182,33 @@ void List_Users(void)
     return;
 
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Users List:");
+  MSG_vShow(MSG_USERS_LIST);
 
-  for (u8 i = 0; i < User_Count; i++)
+  u8 row = 2;
+  for (u8 i = 0; i < MAX_USERS; i++)
   {
-    if (i > 3)
-    {
-      CLCD_vSetPosition(4, 1);
-      CLCD_vSendString((u8 *)"More...");
+    if (!Is_Slot_Used(i))
+      continue;
+
+    if (row > 4)
+    { // Page full, show the next one
+      CLCD_vSetPosition(1, 14);
+      MSG_vShow(MSG_MORE);
       _delay_ms(2000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Users List:");
-      i = i - 3;
+      MSG_vShow(MSG_USERS_LIST);
+      row = 2;
     }
 
     u8 username[21];
     u8 length;
     Read_Username(i, username, &length);
 
-    CLCD_vSetPosition(i % 3 + 1, 1);
+    CLCD_vSetPosition(row, 1);
     CLCD_vSendIntNumber(i + 1);
-    CLCD_vSendString((u8 *)": ");
+    MSG_vShow(MSG_COLON);
     CLCD_vSendString(username);
+    row++;
   }
 
   _delay_ms(3000);
@@ -605,18 +1228,20 @@ void User_Menu(void)
 {
   while (1)
   {
+    CLCD_vBeginFrame();
     CLCD_vClearScreen();
-    CLCD_vSendString((u8 *)"1:Change Pass");
+    MSG_vShow(MSG_MENU_CHANGE_PASS);
     CLCD_vSetPosition(2, 1);
-    CLCD_vSendString((u8 *)"2:Change User");
+    MSG_vShow(MSG_MENU_CHANGE_USER);
     CLCD_vSetPosition(3, 1);
-    CLCD_vSendString((u8 *)"3:Delete Account");
+    MSG_vShow(MSG_MENU_DELETE_ACCOUNT);
     CLCD_vSetPosition(4, 1);
-    CLCD_vSendString((u8 *)"4:Logout");
+    MSG_vShow(MSG_MENU_LOGOUT);
+    CLCD_vEndFrame();
 
     while (1)
     {
-      Error_State = USART_u8ReceiveData(&KPD_Press);
+      Error_State = Menu_Key_Poll(&KPD_Press);
       if (Error_State == OK)
       {
         if (KPD_Press >= '1' && KPD_Press <= '4')
@@ -653,18 +1278,20 @@ void Admin_Menu(void)
 {
   while (1)
   {
+    CLCD_vBeginFrame();
     CLCD_vClearScreen();
-    CLCD_vSendString((u8 *)"1:List Users");
+    MSG_vShow(MSG_MENU_LIST_USERS);
     CLCD_vSetPosition(2, 1);
-    CLCD_vSendString((u8 *)"2:Delete User");
+    MSG_vShow(MSG_MENU_DELETE_USER);
     CLCD_vSetPosition(3, 1);
-    CLCD_vSendString((u8 *)"3:User Menu");
+    MSG_vShow(MSG_MENU_USER_MENU);
     CLCD_vSetPosition(4, 1);
-    CLCD_vSendString((u8 *)"4:Factory Reset");
+    MSG_vShow(MSG_MENU_FACTORY_RESET);
+    CLCD_vEndFrame();
 
     while (1)
     {
-      Error_State = USART_u8ReceiveData(&KPD_Press);
+      Error_State = Menu_Key_Poll(&KPD_Press);
       if (Error_State == OK)
       {
         if (KPD_Press >= '1' && KPD_Press <= '4')
@@ -680,12 +1307,12 @@ void Admin_Menu(void)
     case '2':
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"User Number:");
+      MSG_vShow(MSG_USER_NUMBER);
 
       u8 user_num = 0;
       while (1)
       {
-        Error_State = USART_u8ReceiveData(&KPD_Press);
+        Error_State = Menu_Key_Poll(&KPD_Press);
         if (Error_State == OK)
         {
           if (KPD_Press >= '0' && KPD_Press <= '9')
@@ -695,7 +1322,7 @@ void Admin_Menu(void)
           }
           else if (KPD_Press == 0x0D || KPD_Press == 0x0F)
           {
-            if (user_num > 0 && user_num <= User_Count)
+            if (user_num > 0 && Is_Slot_Used(user_num - 1))
               break;
           }
         }
@@ -723,18 +1350,77 @@ void Admin_Menu(void)
  */
 void EEPROM_vInit(void)
 {
+  u8 layout = EEPROM_vRead(EEPROM_SYSTEM_STATUS);
+  u8 progress = EEPROM_vRead(EEPROM_MIGRATION_PROGRESS);
+
   /* Read number of users */
   User_Count = EEPROM_vRead(EEPROM_UserCount_Location);
   if (User_Count == 0xFF)
-  { // First time initialization
+  { // First time initialization, an erased EEPROM has no old blocks to migrate
     User_Count = 0;
-    EEPROM_vWrite(EEPROM_UserCount_Location, User_Count);
+    if (progress == MIGRATION_IDLE && layout != EEPROM_LAYOUT_VERSION)
+    {
+      layout = EEPROM_LAYOUT_VERSION;
+      EEPROM_vUpdate(EEPROM_SYSTEM_STATUS, layout);
+    }
+    EEPROM_vUpdate(EEPROM_UserCount_Location, User_Count);
+  }
+
+  /* The original layout kept users packed at the front, mark every block past them free
+     and move its last block out of the way of the journal. The journal area was unused
+     then and may hold stale bytes */
+  if (layout != EEPROM_LAYOUT_VERSION && progress == MIGRATION_IDLE)
+  {
+    for (u8 i = User_Count; i < OLD_USER_BLOCKS; i++)
+    {
+      EEPROM_vUpdate(EEPROM_USER_START + (i * OLD_USER_BLOCK_SIZE) + USER_NAME_LENGTH_OFFSET, USER_SLOT_FREE);
+    }
+    Stage_Last_Block();
+    EEPROM_vUpdate(EEPROM_JOURNAL_START, JOURNAL_EMPTY);
+  }
+
+  /* Finish a record update cut short by a reset, a normal boot only reads the marker */
+  Journal_Replay();
+
+  if (layout != EEPROM_LAYOUT_VERSION)
+  {
+    if (progress == MIGRATION_IDLE)
+      EEPROM_vUpdate(EEPROM_MIGRATION_PROGRESS, 0);
+    Migrate_Old_Blocks();
   }
 
-  /* Read number of tries left */
-  if (EEPROM_vRead(EEPROM_NoTries_Location) != NOTPRESSED)
+  /* Build the RAM user directory and the username index. The index lies over old blocks
+     20 and 21, so a migrated layout only gets it once every old block is converted */
+  Directory_Load();
+  if (layout != EEPROM_LAYOUT_VERSION)
+    Index_Rebuild();
+  else
+    Index_Load();
+
+  /* Check every record against its CRC */
+  Records_Verify();
+  if (layout != EEPROM_LAYOUT_VERSION)
+    EEPROM_vUpdate(EEPROM_SYSTEM_STATUS, EEPROM_LAYOUT_VERSION);
+  EEPROM_vUpdate(EEPROM_MIGRATION_PROGRESS, MIGRATION_IDLE);
+
+  if (EEPROM_vRead(EEPROM_UserCount_Location) != User_Count)
+    EEPROM_vUpdate(EEPROM_UserCount_Location, User_Count);
+
+  /* Read number of tries left, the original layout kept it in a single cell */
+  u8 stored_tries = Tries_Ring_Load();
+  u8 old_tries = EEPROM_vRead(EEPROM_NoTries_Location);
+  if (old_tries != NOTPRESSED)
+  {
+    if (old_tries <= Tries_Max)
+    {
+      stored_tries = old_tries;
+      Tries_Ring_Save(stored_tries);
+    }
+    EEPROM_vUpdate(EEPROM_NoTries_Location, NOTPRESSED);
+  }
+  if (stored_tries <= Tries_Max)
   {
-    Tries = EEPROM_vRead(EEPROM_NoTries_Location);
+    Tries = stored_tries;
     if (Tries == 0)
     {
       Error_TimeOut();
@@ -755,15 +1441,15 @@ void UserName_Set(void)
   if (User_Count >= MAX_USERS)
   {
     CLCD_vClearScreen();
-    CLCD_vSendString((u8 *)"Max Users Reached");
+    MSG_vShow(MSG_MAX_USERS_REACHED);
     _delay_ms(1000);
     return;
   }
 
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Set UserName");
+  MSG_vShow(MSG_SET_USERNAME);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"Max chars: ");
+  MSG_vShow(MSG_MAX_CHARS);
   CLCD_vSendIntNumber(USERNAME_MAX_LENGTH);
 
   UserName_Length = 0;
@@ -777,62 +1463,32 @@ void UserName_Set(void)
       if (UserName_Length != 0)
       {
         CLCD_vClearScreen();
-        CLCD_vSendString((u8 *)"Min Length: ");
+        MSG_vShow(MSG_MIN_LENGTH);
         CLCD_vSendIntNumber(USERNAME_MIN_LENGTH);
         _delay_ms(1000);
         CLCD_vClearScreen();
-        CLCD_vSendString((u8 *)"Re Set UserName");
+        MSG_vShow(MSG_RESET_USERNAME);
         CLCD_vSetPosition(2, 1);
-        CLCD_vSendString((u8 *)"Max chars: ");
+        MSG_vShow(MSG_MAX_CHARS);
         UserName_Length = 0;
       }
       CLCD_vSetPosition(3, 1);
-      while (1)
-      {
-        Error_State = USART_u8ReceiveData(&KPD_Press);
-        if (Error_State == OK)
-        {
-          if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-          { // Enter key
-            if (UserName_Length >= USERNAME_MIN_LENGTH || UserName_Length < USERNAME_MIN_LENGTH)
-            {
-              break;
-            }
-            else
-            {
-            }
-          }
-          else if (KPD_Press == 0x08)
-          { // Backspace
-            if (UserName_Length > 0)
-            {
-              UserName_Length--;
-              Clear_Char();
-            }
-          }
-          else if (UserName_Length < USERNAME_MAX_LENGTH)
-          {
-            temp_username[UserName_Length] = KPD_Press;
-            CLCD_vSendData(KPD_Press);
-            UserName_Length++;
-          }
-        }
-      }
+      // Short names are accepted here to show the "Min Length" hint
+      UserName_Length = LINE_u8Read(temp_username, 0, USERNAME_MAX_LENGTH, LINE_ECHO_PLAIN);
     } while (UserName_Length < USERNAME_MIN_LENGTH);
     if (Is_Username_Exists(temp_username, UserName_Length))
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Username exists!");
+      MSG_vShow(MSG_USERNAME_EXISTS);
       _delay_ms(1000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Set UserName");
+      MSG_vShow(MSG_SET_USERNAME);
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Max chars: ");
+      MSG_vShow(MSG_MAX_CHARS);
     }
   } while (Is_Username_Exists(temp_username, UserName_Length));
-  temp_username[UserName_Length] = '\0';
-  Write_Username(User_Count, temp_username, UserName_Length);
 
+  // Kept in RAM only, PassWord_Set stores the whole user block
   for (u8 i = 0; i < UserName_Length; i++)
   {
     UserName[i] = temp_username[i];
@@ -851,9 +1507,9 @@ void PassWord_Set(void)
 {
   USART_u8SendData(0x0D);
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Set Password");
+  MSG_vShow(MSG_SET_PASSWORD);
   CLCD_vSetPosition(2, 1);
-  CLCD_vSendString((u8 *)"Max chars: ");
+  MSG_vShow(MSG_MAX_CHARS);
   CLCD_vSendIntNumber(PASSWORD_MAX_LENGTH);
 
   PassWord_Length = 0;
@@ -866,66 +1522,36 @@ void PassWord_Set(void)
       if (PassWord_Length != 0)
       {
         CLCD_vClearScreen();
-        CLCD_vSendString((u8 *)"Min Length: ");
+        MSG_vShow(MSG_MIN_LENGTH);
         CLCD_vSendIntNumber(PASSWORD_MIN_LENGTH);
         _delay_ms(1000);
         CLCD_vClearScreen();
-        CLCD_vSendString((u8 *)"Re Set Password");
+        MSG_vShow(MSG_RESET_PASSWORD);
         CLCD_vSetPosition(2, 1);
-        CLCD_vSendString((u8 *)"Max chars: ");
+        MSG_vShow(MSG_MAX_CHARS);
         CLCD_vSendIntNumber(PASSWORD_MAX_LENGTH);
         PassWord_Length = 0;
       }
       CLCD_vSetPosition(3, 1);
-      while (1)
-      {
-        Error_State = USART_u8ReceiveData(&KPD_Press);
-
-        if (Error_State == OK)
-        {
-          if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-          { // Enter key
-            if (PassWord_Length >= PASSWORD_MIN_LENGTH || PassWord_Length < PASSWORD_MIN_LENGTH)
-              break;
-          }
-          else if (KPD_Press == 0x08)
-          { // Backspace
-            if (PassWord_Length > 0)
-            {
-              PassWord_Length--;
-              Clear_Char();
-            }
-          }
-          else if (PassWord_Length < PASSWORD_MAX_LENGTH)
-          {
-            temp_password[PassWord_Length] = KPD_Press;
-            CLCD_vSendData(KPD_Press);
-            _delay_ms(200);
-            Clear_Char();
-            CLCD_vSendData('*'); // Show * for password
-            PassWord_Length++;
-          }
-        }
-      }
+      // Short passwords are accepted here to show the "Min Length" hint
+      PassWord_Length = LINE_u8Read(temp_password, 0, PASSWORD_MAX_LENGTH, LINE_ECHO_MASK);
     } while (PassWord_Length < PASSWORD_MIN_LENGTH);
     if (!Is_Password_Valid(temp_password, PassWord_Length))
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Weak Password!");
+      MSG_vShow(MSG_WEAK_PASSWORD);
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Need: A,a,1,@");
+      MSG_vShow(MSG_PASSWORD_RULES);
       _delay_ms(2000);
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Set Password");
+      MSG_vShow(MSG_SET_PASSWORD);
       CLCD_vSetPosition(2, 1);
-      CLCD_vSendString((u8 *)"Max chars: ");
+      MSG_vShow(MSG_MAX_CHARS);
       CLCD_vSendIntNumber(PASSWORD_MAX_LENGTH);
     }
   } while (!Is_Password_Valid(temp_password, PassWord_Length));
 
-  Write_Password(User_Count, temp_password, PassWord_Length);
-  User_Count++;
-  EEPROM_vWrite(EEPROM_UserCount_Location, User_Count);
+  Store_New_User((u8 *)UserName, UserName_Length, temp_password, PassWord_Length);
 }
 
 //=====================================================================================//
@@ -937,66 +1563,18 @@ void PassWord_Set(void)
 void UserName_Check(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Enter Username");
+  MSG_vShow(MSG_ENTER_USERNAME);
   CLCD_vSetPosition(2, 1);
 
-  u8 CheckLength = 0;
   UserName_Check_Flag = 0;
-
-  while (1)
-  {
-    Error_State = USART_u8ReceiveData(&KPD_Press);
-
-    if (Error_State == OK)
-    {
-      if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-      { // Enter key
-        break;
-      }
-      else if (KPD_Press == 0x08)
-      { // Backspace
-        if (CheckLength > 0)
-        {
-          Clear_Char();
-          CheckLength--;
-        }
-      }
-      else if (CheckLength < USERNAME_MAX_LENGTH)
-      {
-        Check[CheckLength] = KPD_Press;
-        CLCD_vSendData(KPD_Press);
-        CheckLength++;
-      }
-    }
-  }
-  Check[CheckLength] = '\0';
+  u8 CheckLength = LINE_u8Read((u8 *)Check, 0, USERNAME_MAX_LENGTH, LINE_ECHO_PLAIN);
 
   // Check against all stored usernames
-  u8 stored_username[21];
-  u8 stored_length;
-
-  for (u8 i = 0; i < User_Count; i++)
+  u8 user_index = Find_User((u8 *)Check, CheckLength, USER_NOT_FOUND);
+  if (user_index != USER_NOT_FOUND)
   {
-    Read_Username(i, stored_username, &stored_length);
-
-    if (CheckLength == stored_length)
-    {
-      u8 match = 1;
-      for (u8 j = 0; j < CheckLength; j++)
-      {
-        if (Check[j] != stored_username[j])
-        {
-          match = 0;
-          break;
-        }
-      }
-      if (match)
-      {
-        UserName_Check_Flag = 1;
-        Current_User = i;
-        break;
-      }
-    }
+    UserName_Check_Flag = 1;
+    Current_User = user_index;
   }
 }
 
@@ -1009,59 +1587,16 @@ void UserName_Check(void)
 void PassWord_Check(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Enter Password");
+  MSG_vShow(MSG_ENTER_PASSWORD);
   CLCD_vSetPosition(2, 1);
 
-  u8 CheckLength = 0;
   PassWord_Check_Flag = 0;
-
-  while (1)
-  {
-    Error_State = USART_u8ReceiveData(&KPD_Press);
-
-    if (Error_State == OK)
-    {
-      if (KPD_Press == 0x0D || KPD_Press == 0x0F)
-      { // Enter key
-        break;
-      }
-      else if (KPD_Press == 0x08)
-      { // Backspace
-        if (CheckLength > 0)
-        {
-          Clear_Char();
-          CheckLength--;
-        }
-      }
-      else if (CheckLength < PASSWORD_MAX_LENGTH)
-      {
-        Check[CheckLength] = KPD_Press;
-        CLCD_vSendData(KPD_Press);
-        _delay_ms(200);
-        Clear_Char();
-        CLCD_vSendData('*'); // Show * for password
-        CheckLength++;
-      }
-    }
-  }
+  u8 CheckLength = LINE_u8Read((u8 *)Check, 0, PASSWORD_MAX_LENGTH, LINE_ECHO_MASK);
 
   // Check password for current user
-  u8 stored_password[21];
-  u8 stored_length;
-
-  Read_Password(Current_User, stored_password, &stored_length);
-
-  if (CheckLength == stored_length)
+  if (Is_Password_Match(Current_User, (u8 *)Check, CheckLength))
   {
     PassWord_Check_Flag = 1;
-    for (u8 i = 0; i < CheckLength; i++)
-    {
-      if (Check[i] != stored_password[i])
-      {
-        PassWord_Check_Flag = 0;
-        break;
-      }
-    }
   }
 }
 
@@ -1082,15 +1617,15 @@ void Sign_In(void)
     if (UserName_Check_Flag == 0 || PassWord_Check_Flag == 0)
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Invalid Login");
+      MSG_vShow(MSG_INVALID_LOGIN);
 
       Tries--;
-      EEPROM_vWrite(EEPROM_NoTries_Location, Tries);
+      Tries_Ring_Save(Tries);
 
       if (Tries > 0)
       {
         CLCD_vSetPosition(2, 1);
-        CLCD_vSendString((u8 *)"Tries Left: ");
+        MSG_vShow(MSG_TRIES_LEFT);
         CLCD_vSendIntNumber(Tries);
         _delay_ms(1000);
       }
@@ -1102,17 +1637,17 @@ void Sign_In(void)
     else
     {
       CLCD_vClearScreen();
-      CLCD_vSendString((u8 *)"Login Success!");
+      MSG_vShow(MSG_LOGIN_SUCCESS_BANNER);
       _delay_ms(1000);
 
       // Reset tries on successful login
-      EEPROM_vWrite(EEPROM_NoTries_Location, NOTPRESSED);
+      Tries_Ring_Save(NOTPRESSED);
       Tries = Tries_Max;
 
       // Read and display username
       Read_Username(Current_User, UserName, &UserName_Length);
       CLCD_vClearScreen();
-      CLCD_vSendString("Welcome ");
+      MSG_vShow(MSG_WELCOME);
       CLCD_vSetPosition(3, ((20 - UserName_Length) / 2) + 1); // Center username on LCD
       CLCD_vSendString(UserName);
       _delay_ms(1000);
@@ -1130,7 +1665,7 @@ void Sign_In(void)
 void Error_TimeOut(void)
 {
   CLCD_vClearScreen();
-  CLCD_vSendString((u8 *)"Time out: ");
+  MSG_vShow(MSG_TIME_OUT);
 
   for (u8 i = 5; i > 0; i--)
   {
@@ -1139,7 +1674,7 @@ void Error_TimeOut(void)
     _delay_ms(1000);
   }
 
-  EEPROM_vWrite(EEPROM_NoTries_Location, NOTPRESSED);
+  Tries_Ring_Save(NOTPRESSED);
   Tries = Tries_Max;
 }
 
@@ -1169,15 +1704,102 @@ void Factory_Reset(void)
   if (PassWord_Check_Flag == 1)
   {
     CLCD_vClearScreen();
-    CLCD_vSendString("Loading ...");
-    for (u16 addr = EEPROM_START_ADDRESS; addr <= EEPROM_END_ADDRESS; addr++)
-      {
-        EEPROM_vWrite(addr, 0xFF);
-      }
-      User_Count = 0;
-      Tries = Tries_Max;
-      Log_Event(EVENT_SYSTEM_RESET, 0);
+    MSG_vShow(MSG_LOADING);
+    Erase_All_Data();
+    Log_Event(EVENT_SYSTEM_RESET, 0);
+  }
+}
+
+/**
+ * @brief Erases the whole EEPROM and reloads the empty user table
+ * @details No confirmation, callers check the admin password first
+ */
+void Erase_All_Data(void)
+{
+  /* Top down, so the status bytes go last and a cut erase is not taken for a blank EEPROM */
+  for (u16 addr = EEPROM_END_ADDRESS + 1; addr > EEPROM_START_ADDRESS; addr--)
+  {
+    EEPROM_vUpdate(addr - 1, 0xFF);
+  }
+  Tries = Tries_Max;
+  EEPROM_vInit(); // Reload the now empty user table
+}
+
+//=====================================================================================//
+
+/**
+ * @brief Adds a user without any prompt
+ * @param username Username to store
+ * @param username_length Length of the username
+ * @param password Password to store
+ * @param password_length Length of the password
+ * @return Index of the new user, USER_NOT_FOUND if the table is full, the
+ *         username is taken or either field breaks the length/complexity rules
+ */
+u8 User_Add(u8 *username, u8 username_length, u8 *password, u8 password_length)
+{
+  if (User_Count >= MAX_USERS || Free_Count == 0 ||
+      username_length < USERNAME_MIN_LENGTH || username_length > USERNAME_MAX_LENGTH ||
+      password_length > PASSWORD_MAX_LENGTH || !Is_Password_Valid(password, password_length) ||
+      Find_User(username, username_length, USER_NOT_FOUND) != USER_NOT_FOUND)
+  {
+    return USER_NOT_FOUND;
   }
+
+  return Store_New_User(username, username_length, password, password_length);
+}
+
+/**
+ * @brief Removes a user without any prompt
+ * @param user_index Index of the user
+ * @return true if the user existed and was removed, false otherwise
+ */
+bool User_Remove(u8 user_index)
+{
+  if (!Is_Slot_Used(user_index))
+    return false;
+
+  Remove_User(user_index);
+  return true;
+}
+
+/**
+ * @brief Reads the username of a user block
+ * @param user_index Index of the user
+ * @param username Buffer of USERNAME_MAX_LENGTH + 1 bytes
+ * @return Length of the username, 0 if the block is free
+ */
+u8 User_Get_Name(u8 user_index, u8 *username)
+{
+  u8 length = 0;
+
+  if (Is_Slot_Used(user_index))
+    Read_Username(user_index, username, &length);
+  return length;
+}
+
+/**
+ * @brief Checks a password against the admin account
+ * @param password Password to check
+ * @param length Length of the password
+ * @return true if an admin exists and the password matches
+ */
+bool Admin_Password_Match(u8 *password, u8 length)
+{
+  return Is_Slot_Used(0) && Is_Password_Match(0, password, length);
+}
+
+/**
+ * @brief Reloads the RAM tables after the user blocks were written directly
+ * @details Rebuilds the directory and the username index, checks every
+ *          record CRC and stores the new user count
+ */
+void User_Table_Reload(void)
+{
+  Directory_Load();
+  Index_Rebuild();
+  Records_Verify();
+  Save_Async(EEPROM_UserCount_Location, (const u8 *)&User_Count, 1, NULL);
 }
 
 //=====================================================================================//
@@ -76,4 +76,30 @@
 #define CLCD_RW DIO_PIN5
 #define CLCD_EN DIO_PIN4
 
+/*___________________________________________________________________________________________________________________*/
+
+/* Busy Flag */
+/*
+*Read the busy flag on D7 before every write (needs CLCD_RW wired), a controller that stays busy
+*switches the driver to fixed delays
+*Optoins :-
+  1- ENABLE
+  2- DISABLE  (wait the worst case execution time after every write)
+*/
+#define CLCD_BUSY_FLAG ENABLE
+
+/*___________________________________________________________________________________________________________________*/
+
+/* Refresh */
+/*
+*How the shadow framebuffer reaches the LCD
+*Optoins :-
+  1- CLCD_REFRESH_SYNC   (the caller sends the changed cells, at once outside a frame)
+  2- CLCD_REFRESH_ASYNC  (the Timer0 tick sends them, the API only writes RAM, needs TIMER_vInit and GIE)
+*/
+#define CLCD_REFRESH CLCD_REFRESH_ASYNC
+
+/* Bytes sent by every 1 ms tick in CLCD_REFRESH_ASYNC, the ISR waits about 40 us for each one after the first */
+#define CLCD_REFRESH_BYTES_PER_TICK 2
+
 #endif /* CLCD_CONFIG_H_ */
@@ -58,6 +58,9 @@
 #define CLCD_HIGH_NIBBLE                   0
 #define CLCD_LOW_NIBBLE                    1
 
+#define CLCD_REFRESH_SYNC                  0
+#define CLCD_REFRESH_ASYNC                 1
+
 /*___________________________________________________________________________________________________________________*/
 
 void CLCD_vInit                    (void                                );
@@ -67,7 +70,9 @@ void CLCD_vClearScreen             (void);
 void CLCD_vSetPosition             (u8 Copy_u8ROW, u8 Copy_u8Col        );
 
 void CLCD_vSendString              ( u8 *Copy_u8PrtStrign          );
+void CLCD_vSendString_P            (const u8 *Copy_pu8String            );
 void CLCD_vSendIntNumber           (s32 Copy_s32Number                  );
+void CLCD_vSendIntNumberWidth      (s32 Copy_s32Number, u8 Copy_u8Width, u8 Copy_u8Pad);
 void CLCD_vSendFloatNumber         (f64 Copy_f64Number                  );
 
 void CLCD_voidShiftDisplayRight    (void                                );
@@ -75,4 +80,7 @@ void CLCD_voidShiftDisplayLeft     (void                                );
 
 void CLCD_vSendExtraChar           (u8 Copy_u8Row, u8 Copy_u8Col        );
 
+void CLCD_vBeginFrame              (void                                );
+void CLCD_vEndFrame                (void                                );
+
 #endif /* CLCD_INTERFACE_H_ */
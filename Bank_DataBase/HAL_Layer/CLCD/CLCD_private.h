@@ -9,6 +9,48 @@
 #ifndef CLCD_PRIVATE_H_
 #define CLCD_PRIVATE_H_
 
+/* Execution times used without the busy flag (HD44780 at 270 kHz, with margin) */
+#define CLCD_EXEC_TIME_US                  50
+#define CLCD_CLEAR_TIME_US                 2000
+
+/* Busy flag reads (about 5 us each) before giving up on it */
+#define CLCD_BUSY_MAX_POLLS                1000
+
+/* Busy flag reads the refresh tick makes before leaving the byte to the next tick */
+#define CLCD_TICK_MAX_POLLS                4
+
+#if (CLCD_BUSY_MAX_POLLS / CLCD_TICK_MAX_POLLS) > 255
+#error "CLCD_BUSY_MAX_POLLS / CLCD_TICK_MAX_POLLS must fit in the busy tick counter"
+#endif
+
+/* Data pin carrying the busy flag (D7) */
+#if (CLCD_MODE == 4) && (CLCD_DATA_NIBBLE == CLCD_LOW_NIBBLE)
+#define CLCD_BF_PIN                        DIO_PIN3
+#else
+#define CLCD_BF_PIN                        DIO_PIN7
+#endif
+
+/* Shadow framebuffer of the 20x4 display */
+#define CLCD_COLS                          20
+#define CLCD_ROWS                          4
+#define CLCD_CELLS                         (CLCD_COLS * CLCD_ROWS)
+#define CLCD_ALL_ROWS                      0x0F
+
+/* DDRAM in 2 lines mode : line 1 = 0x00:0x27 (rows 1 and 3), line 2 = 0x40:0x67 (rows 2 and 4) */
+#define CLCD_LINE_LENGTH                   40
+#define CLCD_LINE2_ADDRESS                 0x40
+#define CLCD_ADDRESS_MASK                  0x7F
+#define CLCD_NO_ADDRESS                    0xFF
+
 static void CLCD_vSendFallingEdge(void);
+static u8   CLCD_u8WaitReady(u16 Copy_u16MaxPolls);
+static void CLCD_vWrite(u8 Copy_u8Byte, u8 Copy_u8RS);
+static u8   CLCD_u8CellIndex(u8 Copy_u8Address);
+static u8   CLCD_u8CellAddress(u8 Copy_u8Cell);
+static u8   CLCD_u8NextAddress(u8 Copy_u8Address);
+static u8   CLCD_u8PrevAddress(u8 Copy_u8Address);
+static u8   CLCD_u8FlushStep(void);
+static void CLCD_vFlush(void);
+static void CLCD_vRefreshTick(void);
 
 #endif /* CLCD_PRIVATE_H_ */
@@ -9,17 +9,36 @@
 
 #define F_CPU 8000000UL
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 
 #include "../../APP_Layer/STD_Macros.h"
 #include "../../APP_Layer/STD_TYPES.h"
 
 #include "../../MCAL_Layer/DIO/DIO_interface.h"
+#include "../../MCAL_Layer/TIMER/TIMER_interface.h"
+#include "../../MCAL_Layer/FMT/FMT_interface.h"
 
 #include "CLCD_interface.h"
 #include "CLCD_config.h"
 #include "CLCD_private.h"
 #include "CLCD_extrachar.h"
 
+/*Busy flag is read once the init sequence is done, and not any more if it did not clear in time*/
+static u8 CLCD_u8UseBusyFlag = 0;
+static u8 CLCD_u8BusyTicks = 0;                            // refresh ticks in a row that found the LCD busy
+
+/*Shadow framebuffer, cell = ((row - 1) * CLCD_COLS) + (col - 1), shared with the refresh tick*/
+static volatile u8 CLCD_u8Shadow[CLCD_CELLS];              // what the screen should show
+static volatile u8 CLCD_u8Shown[CLCD_CELLS];               // what the controller DDRAM holds
+static volatile u8 CLCD_u8DirtyRows = 0;                   // bit n set : row n + 1 has cells to flush
+static volatile u8 CLCD_u8Cursor = 0;                      // DDRAM address of the next character
+static volatile u8 CLCD_u8HwCursor = CLCD_NO_ADDRESS;      // DDRAM address held by the controller AC
+static volatile u8 CLCD_u8InCgram = 0;                     // AC refers to CGRAM, data is not shadowed
+static volatile u8 CLCD_u8FrameDepth = 0;                  // nesting of CLCD_vBeginFrame, also keeps the refresh tick off the bus
+
+/*Rows in DDRAM address order, the end of one row is followed by the start of the next*/
+static const u8 CLCD_u8RowOrder[CLCD_ROWS] = {0, 2, 1, 3};
+
 /*___________________________________________________________________________________________________________________*/
 /*
 ###########  8 Bits Mode                                 ###########  4 Bits Mode
@@ -51,6 +70,8 @@
  */
 void CLCD_vInit(void)
 {
+  u8 LOC_u8Cell;
+
   /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    8 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 #if CLCD_MODE == 8
 
@@ -61,18 +82,18 @@ void CLCD_vInit(void)
   DIO_enumSetPinDir(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_OUTPUT);
   DIO_enumSetPinDir(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_OUTPUT);
 
-  CLCD_vSendCommand(CLCD_HOME);
+  CLCD_vWrite(CLCD_HOME, DIO_PIN_LOW);
   _delay_ms(10);
 
-  CLCD_vSendCommand(EIGHT_BITS);
+  CLCD_vWrite(EIGHT_BITS, DIO_PIN_LOW);
   _delay_ms(1);
 
-  CLCD_vSendCommand(CLCD_DISPLAY_CURSOR);
+  CLCD_vWrite(CLCD_DISPLAY_CURSOR, DIO_PIN_LOW);
   _delay_ms(1);
 
-  CLCD_vClearScreen();
+  CLCD_vWrite(CLCD_ClEAR, DIO_PIN_LOW);
 
-  CLCD_vSendCommand(CLCD_ENTRY_MODE);
+  CLCD_vWrite(CLCD_ENTRY_MODE, DIO_PIN_LOW);
   _delay_ms(1);
 
   /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    4 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
@@ -105,24 +126,47 @@ void CLCD_vInit(void)
   DIO_enumSetPinDir(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_OUTPUT);
   DIO_enumSetPinDir(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_OUTPUT);
 
-  CLCD_vSendCommand(CLCD_HOME);
+  CLCD_vWrite(CLCD_HOME, DIO_PIN_LOW);
   _delay_ms(10);
 
-  CLCD_vSendCommand(FOUR_BITS);
+  CLCD_vWrite(FOUR_BITS, DIO_PIN_LOW);
   _delay_ms(1);
 
-  CLCD_vSendCommand(CLCD_DISPLAY_CURSOR);
+  CLCD_vWrite(CLCD_DISPLAY_CURSOR, DIO_PIN_LOW);
   _delay_ms(1);
 
-  CLCD_vClearScreen();
+  CLCD_vWrite(CLCD_ClEAR, DIO_PIN_LOW);
 
-  CLCD_vSendCommand(CLCD_ENTRY_MODE);
+  CLCD_vWrite(CLCD_ENTRY_MODE, DIO_PIN_LOW);
   _delay_ms(1);
 
 #else
 
 #error "Wrong CLCD_MODE Config"
 
+#endif
+
+#if CLCD_BUSY_FLAG == ENABLE
+  CLCD_u8UseBusyFlag = 1;
+#elif CLCD_BUSY_FLAG != DISABLE
+#error "Wrong CLCD_BUSY_FLAG Config"
+#endif
+
+  /* the LCD is blank with the AC at 0 */
+  for (LOC_u8Cell = 0; LOC_u8Cell < CLCD_CELLS; LOC_u8Cell++)
+  {
+    CLCD_u8Shadow[LOC_u8Cell] = ' ';
+    CLCD_u8Shown[LOC_u8Cell] = ' ';
+  }
+  CLCD_u8DirtyRows = 0;
+  CLCD_u8Cursor = 0;
+  CLCD_u8HwCursor = 0;
+  CLCD_u8InCgram = 0;
+
+#if CLCD_REFRESH == CLCD_REFRESH_ASYNC
+  TIMER_vSetTickCallBack(CLCD_vRefreshTick);
+#elif CLCD_REFRESH != CLCD_REFRESH_SYNC
+#error "Wrong CLCD_REFRESH Config"
 #endif
 }
 
@@ -134,91 +178,245 @@ void CLCD_vInit(void)
  * Parameters :
  *		=> Copy_u8Data --> Data that you want to display (for every location )
  * return     : nothing
+ *
+ * Hint       :-
+ *		The character goes to the shadow framebuffer, it reaches the LCD now or at CLCD_vEndFrame
+ *		In CLCD_REFRESH_ASYNC the refresh tick sends it, the call only writes RAM
  */
 void CLCD_vSendData(u8 Copy_u8Data)
 {
-  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    8 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+  u8 LOC_u8Cell;
 
-#if CLCD_MODE == 8
+  if (CLCD_u8InCgram)
+  {
+    CLCD_vWrite(Copy_u8Data, DIO_PIN_HIGH); // character pattern row
+  }
+  else
+  {
+    LOC_u8Cell = CLCD_u8CellIndex(CLCD_u8Cursor);
+    if (LOC_u8Cell < CLCD_CELLS)
+    {
+      CLCD_u8Shadow[LOC_u8Cell] = Copy_u8Data;
+      if (CLCD_u8Shadow[LOC_u8Cell] != CLCD_u8Shown[LOC_u8Cell])
+      {
+        SET_BIT(CLCD_u8DirtyRows, (LOC_u8Cell / CLCD_COLS));
+      }
+    }
+    CLCD_u8Cursor = CLCD_u8NextAddress(CLCD_u8Cursor);
 
-  DIO_enumWritePortVal(CLCD_DATA_PORT, Copy_u8Data);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, DIO_PIN_HIGH);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
-  CLCD_vSendFallingEdge();
+#if CLCD_REFRESH == CLCD_REFRESH_SYNC
+    if (CLCD_u8FrameDepth == 0)
+    {
+      CLCD_vFlush();
+    }
+#endif
+  }
+}
 
-  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    4 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+/*___________________________________________________________________________________________________________________*/
 
-#elif CLCD_MODE == 4
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                       This Function Interface to send the configuration commands to the LCD Driver
+ *                                                *------------------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_u8Command --> Command number
+ * return     : nothing
+ *
+ * Hint       :-
+ *		Clear, return home, set cursor and cursor shift only change the shadow inside a frame (always in CLCD_REFRESH_ASYNC)
+ *		Any other command is sent at once
+ */
+void CLCD_vSendCommand(u8 Copy_u8Command)
+{
+  u8 LOC_u8Cell;
 
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, DIO_PIN_HIGH);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
-  
-#if CLCD_DATA_NIBBLE == CLCD_HIGH_NIBBLE
+  if (Copy_u8Command == CLCD_ClEAR)
+  {
+    for (LOC_u8Cell = 0; LOC_u8Cell < CLCD_CELLS; LOC_u8Cell++)
+    {
+      CLCD_u8Shadow[LOC_u8Cell] = ' ';
+    }
+    CLCD_u8DirtyRows = CLCD_ALL_ROWS;
+    CLCD_u8Cursor = 0;
+  }
+  else if ((Copy_u8Command & 0xFE) == CLCD_HOME)
+  {
+    CLCD_u8Cursor = 0;
+  }
+  else if (Copy_u8Command & CLCD_SET_CURSOR)
+  {
+    CLCD_u8Cursor = Copy_u8Command & CLCD_ADDRESS_MASK;
+    CLCD_u8InCgram = 0;
+  }
+  else if ((Copy_u8Command & 0xF8) == CLCD_SHIFT_CURSOR_LEFT)
+  {
+    if (Copy_u8Command & 0x04)
+    {
+      CLCD_u8Cursor = CLCD_u8NextAddress(CLCD_u8Cursor);
+    }
+    else
+    {
+      CLCD_u8Cursor = CLCD_u8PrevAddress(CLCD_u8Cursor);
+    }
+  }
+  else
+  {
+    /* display control, function set, entry mode, display shift and CGRAM address */
+    CLCD_u8FrameDepth++; // the refresh tick stays off the bus
+    CLCD_vWrite(Copy_u8Command, DIO_PIN_LOW);
+    if ((Copy_u8Command & 0xC0) == CLCD_CGRAM)
+    {
+      CLCD_u8InCgram = 1;
+      CLCD_u8HwCursor = CLCD_NO_ADDRESS;
+    }
+    CLCD_u8FrameDepth--;
+    return;
+  }
 
-  DIO_vWriteHighNibble(CLCD_DATA_PORT, (Copy_u8Data >> 4)); // send the most 4 bits of data to high nibbles
-  CLCD_vSendFallingEdge();
-  DIO_vWriteHighNibble(CLCD_DATA_PORT, Copy_u8Data); // send the least 4 bits of data to high nibbles
-  CLCD_vSendFallingEdge();
+#if CLCD_REFRESH == CLCD_REFRESH_SYNC
+  if (CLCD_u8FrameDepth == 0)
+  {
+    if (Copy_u8Command <= (CLCD_HOME | 1))
+    {
+      /* the controller clears faster than 80 data writes */
+      CLCD_vWrite(Copy_u8Command, DIO_PIN_LOW);
+      if (Copy_u8Command == CLCD_ClEAR)
+      {
+        for (LOC_u8Cell = 0; LOC_u8Cell < CLCD_CELLS; LOC_u8Cell++)
+        {
+          CLCD_u8Shown[LOC_u8Cell] = ' ';
+        }
+        CLCD_u8DirtyRows = 0;
+      }
+      CLCD_u8HwCursor = 0;
+      CLCD_u8InCgram = 0;
+    }
+    CLCD_vFlush();
+  }
+#endif
+}
 
-#elif CLCD_DATA_NIBBLE == CLCD_LOW_NIBBLE
+/*___________________________________________________________________________________________________________________*/
 
-  DIO_vWriteLowNibble(CLCD_DATA_PORT, (Copy_u8Data >> 4)); // send the most 4 bits of data to low nibbles
-  CLCD_vSendFallingEdge();
-  DIO_vWriteLowNibble(CLCD_DATA_PORT, Copy_u8Data); // send the least 4 bits of data to low nibbles
-  CLCD_vSendFallingEdge();
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function send a pulse (falling edge ) to Enable Pin
+ *                                             *-------------------------------------------------------------*
+ * Parameters : nothing
+ * return     : nothing
+ */
 
-#else
+static void CLCD_vSendFallingEdge(void)
+{
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_HIGH);
+  _delay_us(1); // enable pulse width, at least 450 ns
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_LOW);
+  _delay_us(1);
+}
 
-#error "Wrong CLCD_DATA_NIBBLE Config"
+/*___________________________________________________________________________________________________________________*/
 
-#endif
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function waits until the busy flag (D7) is cleared
+ *                                             *-------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_u16MaxPolls --> busy flag reads before giving up
+ * return     : 1 when the LCD is ready, 0 when it was still busy after the last read
+ *
+ * Hint       :-
+ *		In 4 bits mode every read takes two pulses, the second nibble (address counter) is ignored
+ */
+static u8 CLCD_u8WaitReady(u16 Copy_u16MaxPolls)
+{
+  u16 LOC_u16Polls = 0;
+  u8 LOC_u8Busy;
 
+  /*data pins as inputs without pull ups, the LCD drives them while EN is high*/
+#if CLCD_MODE == 8
+  DIO_enumWritePortVal(CLCD_DATA_PORT, 0x00);
+  DIO_enumSetPortDir(CLCD_DATA_PORT, DIO_PORT_INPUT);
+#elif CLCD_DATA_NIBBLE == CLCD_HIGH_NIBBLE
+  DIO_vWriteHighNibble(CLCD_DATA_PORT, 0x00);
+  DIO_vSetHighNibbleDir(CLCD_DATA_PORT, 0x00);
 #else
+  DIO_vWriteLowNibble(CLCD_DATA_PORT, 0x00);
+  DIO_vSetLowNibbleDir(CLCD_DATA_PORT, 0x00);
+#endif
 
-#error "Wrong CLCD_MODE Config"
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, DIO_PIN_LOW);
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_HIGH);
 
+  do
+  {
+    DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_HIGH);
+    _delay_us(1); // data valid 360 ns after EN rises
+    DIO_enumReadPinVal(CLCD_DATA_PORT, CLCD_BF_PIN, &LOC_u8Busy);
+    DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_LOW);
+    _delay_us(1);
+#if CLCD_MODE == 4
+    CLCD_vSendFallingEdge();
+#endif
+    LOC_u16Polls++;
+  } while ((LOC_u8Busy != DIO_PIN_LOW) && (LOC_u16Polls < Copy_u16MaxPolls));
+
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
+
+#if CLCD_MODE == 8
+  DIO_enumSetPortDir(CLCD_DATA_PORT, DIO_PORT_OUTPUT);
+#elif CLCD_DATA_NIBBLE == CLCD_HIGH_NIBBLE
+  DIO_vSetHighNibbleDir(CLCD_DATA_PORT, 0x0F);
+#else
+  DIO_vSetLowNibbleDir(CLCD_DATA_PORT, 0x0F);
 #endif
+
+  return (LOC_u8Busy == DIO_PIN_LOW);
 }
 
 /*___________________________________________________________________________________________________________________*/
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
- *         	                                       This Function Interface to send the configuration commands to the LCD Driver
- *                                                *------------------------------------------------------------------------*
+ *         	                                      This Function writes one instruction or data byte to the LCD
+ *                                             *-------------------------------------------------------------*
  * Parameters :
- *		=> Copy_u8Command --> Command number
+ *		=> Copy_u8Byte --> instruction or data
+ *		=> Copy_u8RS   --> DIO_PIN_LOW for an instruction, DIO_PIN_HIGH for data
  * return     : nothing
+ *
+ * Hint       :-
+ *		A busy flag that does not clear in time (RW not wired) switches the driver to fixed delays,
+ *		the refresh tick makes sure the LCD is ready before it gets here, so only the thread ever waits that long
  */
-void CLCD_vSendCommand(u8 Copy_u8Command)
+static void CLCD_vWrite(u8 Copy_u8Byte, u8 Copy_u8RS)
 {
-  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    8 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+  if (CLCD_u8UseBusyFlag && (CLCD_u8WaitReady(CLCD_BUSY_MAX_POLLS) == 0))
+  {
+    CLCD_u8UseBusyFlag = 0;
+    _delay_us(CLCD_CLEAR_TIME_US);
+  }
 
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, Copy_u8RS);
+  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
+
+  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    8 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 #if CLCD_MODE == 8
 
-  DIO_enumWritePortVal(CLCD_DATA_PORT, Copy_u8Command);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, DIO_PIN_LOW);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
+  DIO_enumWritePortVal(CLCD_DATA_PORT, Copy_u8Byte);
   CLCD_vSendFallingEdge();
 
-  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    4 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
-
+  /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    4 Bits Mode     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 #elif CLCD_MODE == 4
 
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RS, DIO_PIN_LOW);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_RW, DIO_PIN_LOW);
-
 #if CLCD_DATA_NIBBLE == CLCD_HIGH_NIBBLE
 
-  DIO_vWriteHighNibble(CLCD_DATA_PORT, (Copy_u8Command >> 4)); // send the most 4 bits of data to high nibbles
+  DIO_vWriteHighNibble(CLCD_DATA_PORT, (Copy_u8Byte >> 4)); // send the most 4 bits of data to high nibbles
   CLCD_vSendFallingEdge();
-  DIO_vWriteHighNibble(CLCD_DATA_PORT, Copy_u8Command); // send the least 4 bits of data to high nibbles
+  DIO_vWriteHighNibble(CLCD_DATA_PORT, Copy_u8Byte); // send the least 4 bits of data to high nibbles
   CLCD_vSendFallingEdge();
 
 #elif CLCD_DATA_NIBBLE == CLCD_LOW_NIBBLE
 
-  DIO_vWriteLowNibble(CLCD_DATA_PORT, (Copy_u8Command >> 4)); // send the most 4 bits of data to low nibbles
+  DIO_vWriteLowNibble(CLCD_DATA_PORT, (Copy_u8Byte >> 4)); // send the most 4 bits of data to low nibbles
   CLCD_vSendFallingEdge();
-  DIO_vWriteLowNibble(CLCD_DATA_PORT, Copy_u8Command); // send the least 4 bits of data to low nibbles
+  DIO_vWriteLowNibble(CLCD_DATA_PORT, Copy_u8Byte); // send the least 4 bits of data to low nibbles
   CLCD_vSendFallingEdge();
 
 #else
@@ -232,23 +430,215 @@ void CLCD_vSendCommand(u8 Copy_u8Command)
 #error "Wrong CLCD_MODE Config"
 
 #endif
+
+  if (CLCD_u8UseBusyFlag == 0)
+  {
+    if ((Copy_u8RS == DIO_PIN_LOW) && (Copy_u8Byte <= (CLCD_HOME | 1)))
+    {
+      _delay_us(CLCD_CLEAR_TIME_US); // clear and return home take 1.53 ms
+    }
+    else
+    {
+      _delay_us(CLCD_EXEC_TIME_US); // everything else takes 37 us
+    }
+  }
 }
 
 /*___________________________________________________________________________________________________________________*/
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
- *         	                                      This Function send a pulse (falling edge ) to Enable Pin
+ *         	                                      This Function maps a DDRAM address to its shadow cell
+ *                                             *-------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_u8Address --> DDRAM address
+ * return     : cell index, CLCD_CELLS for an address outside the 2 lines
+ */
+static u8 CLCD_u8CellIndex(u8 Copy_u8Address)
+{
+  u8 LOC_u8Row = 0;
+  u8 LOC_u8Col = Copy_u8Address & (CLCD_LINE2_ADDRESS - 1);
+
+  if (Copy_u8Address & CLCD_LINE2_ADDRESS)
+  {
+    LOC_u8Row = 1;
+  }
+  if (LOC_u8Col >= CLCD_LINE_LENGTH)
+  {
+    return CLCD_CELLS;
+  }
+  if (LOC_u8Col >= CLCD_COLS)
+  {
+    LOC_u8Row += 2; // second half of a line is the row below the other line
+    LOC_u8Col -= CLCD_COLS;
+  }
+  return (LOC_u8Row * CLCD_COLS) + LOC_u8Col;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function maps a shadow cell to its DDRAM address
+ *                                             *-------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_u8Cell --> cell index (0 ... CLCD_CELLS - 1)
+ * return     : DDRAM address
+ */
+static u8 CLCD_u8CellAddress(u8 Copy_u8Cell)
+{
+  u8 LOC_u8Row = Copy_u8Cell / CLCD_COLS;
+  u8 LOC_u8Address = Copy_u8Cell % CLCD_COLS;
+
+  if (LOC_u8Row & 1)
+  {
+    LOC_u8Address += CLCD_LINE2_ADDRESS;
+  }
+  if (LOC_u8Row & 2)
+  {
+    LOC_u8Address += CLCD_COLS;
+  }
+  return LOC_u8Address;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      These Functions move a DDRAM address the way the AC does
+ *                                             *-------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_u8Address --> DDRAM address
+ * return     : the address after (or before) it, line 1 and line 2 wrap into each other
+ */
+static u8 CLCD_u8NextAddress(u8 Copy_u8Address)
+{
+  Copy_u8Address++;
+  if (Copy_u8Address == CLCD_LINE_LENGTH)
+  {
+    Copy_u8Address = CLCD_LINE2_ADDRESS;
+  }
+  else if (Copy_u8Address == (CLCD_LINE2_ADDRESS + CLCD_LINE_LENGTH))
+  {
+    Copy_u8Address = 0;
+  }
+  return Copy_u8Address;
+}
+
+static u8 CLCD_u8PrevAddress(u8 Copy_u8Address)
+{
+  if (Copy_u8Address == 0)
+  {
+    Copy_u8Address = CLCD_LINE2_ADDRESS + CLCD_LINE_LENGTH;
+  }
+  else if (Copy_u8Address == CLCD_LINE2_ADDRESS)
+  {
+    Copy_u8Address = CLCD_LINE_LENGTH;
+  }
+  return Copy_u8Address - 1;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function sends the next byte that brings the LCD closer to the shadow
+ *                                             *-------------------------------------------------------------*
+ * Parameters : nothing
+ * return     : 1 when a byte was sent, 0 when the LCD already matches the shadow
+ *
+ * Hint       :-
+ *		Only dirty rows are compared, a set cursor command is sent only where the changed cells are not contiguous
+ *		At the end the controller AC is moved to the shadow cursor
+ *		A row stays dirty until a scan finds no difference, so cells written while a flush runs are not lost
+ */
+static u8 CLCD_u8FlushStep(void)
+{
+  u8 LOC_u8Iterator;
+  u8 LOC_u8Row;
+  u8 LOC_u8Cell;
+  u8 LOC_u8End;
+  u8 LOC_u8Data;
+  u8 LOC_u8Address;
+
+  for (LOC_u8Iterator = 0; LOC_u8Iterator < CLCD_ROWS; LOC_u8Iterator++)
+  {
+    LOC_u8Row = CLCD_u8RowOrder[LOC_u8Iterator];
+    if (IS_BIT_SET(CLCD_u8DirtyRows, LOC_u8Row))
+    {
+      LOC_u8End = (LOC_u8Row + 1) * CLCD_COLS;
+      for (LOC_u8Cell = LOC_u8Row * CLCD_COLS; LOC_u8Cell < LOC_u8End; LOC_u8Cell++)
+      {
+        LOC_u8Data = CLCD_u8Shadow[LOC_u8Cell];
+        if (LOC_u8Data != CLCD_u8Shown[LOC_u8Cell])
+        {
+          LOC_u8Address = CLCD_u8CellAddress(LOC_u8Cell);
+          if (LOC_u8Address != CLCD_u8HwCursor)
+          {
+            CLCD_vWrite(CLCD_SET_CURSOR | LOC_u8Address, DIO_PIN_LOW);
+            CLCD_u8HwCursor = LOC_u8Address;
+          }
+          else
+          {
+            CLCD_vWrite(LOC_u8Data, DIO_PIN_HIGH);
+            CLCD_u8Shown[LOC_u8Cell] = LOC_u8Data;
+            CLCD_u8HwCursor = CLCD_u8NextAddress(LOC_u8Address);
+          }
+          return 1;
+        }
+      }
+      CLR_BIT(CLCD_u8DirtyRows, LOC_u8Row);
+    }
+  }
+
+  if ((CLCD_u8HwCursor != CLCD_u8Cursor) && (CLCD_u8InCgram == 0))
+  {
+    CLCD_u8HwCursor = CLCD_u8Cursor;
+    CLCD_vWrite(CLCD_SET_CURSOR | CLCD_u8HwCursor, DIO_PIN_LOW);
+    return 1;
+  }
+  return 0;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function sends every shadow cell that differs from the LCD
  *                                             *-------------------------------------------------------------*
  * Parameters : nothing
  * return     : nothing
  */
+static void CLCD_vFlush(void)
+{
+  while (CLCD_u8FlushStep())
+  {
+  }
+}
 
-static void CLCD_vSendFallingEdge(void)
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function is the refresh tick, run by the Timer0 ISR every millisecond
+ *                                             *-------------------------------------------------------------*
+ * Parameters : nothing
+ * return     : nothing
+ *
+ * Hint       :-
+ *		Nothing is sent inside a frame, while a command is written directly or while the AC refers to CGRAM
+ *		Clear and return home are never sent from here, so every byte takes at most 40 us
+ *		An LCD still busy after CLCD_TICK_MAX_POLLS reads is left to the next tick, once the ticks in a row
+ *		have read the flag CLCD_BUSY_MAX_POLLS times the driver switches to fixed delays without waiting here
+ */
+static void CLCD_vRefreshTick(void)
 {
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_HIGH);
-  _delay_ms(1);
-  DIO_enumWritePinVal(CLCD_CONTROL_PORT, CLCD_EN, DIO_PIN_LOW);
-  _delay_ms(1);
+  u8 LOC_u8Bytes;
+
+  if ((CLCD_u8FrameDepth == 0) && (CLCD_u8InCgram == 0))
+  {
+    for (LOC_u8Bytes = 0; LOC_u8Bytes < CLCD_REFRESH_BYTES_PER_TICK; LOC_u8Bytes++)
+    {
+      if (CLCD_u8UseBusyFlag && (CLCD_u8WaitReady(CLCD_TICK_MAX_POLLS) == 0))
+      {
+        CLCD_u8BusyTicks++;
+        if (CLCD_u8BusyTicks >= (CLCD_BUSY_MAX_POLLS / CLCD_TICK_MAX_POLLS))
+        {
+          CLCD_u8UseBusyFlag = 0; // the LCD had far longer than any instruction takes
+        }
+        break;
+      }
+      CLCD_u8BusyTicks = 0;
+      if (CLCD_u8FlushStep() == 0)
+      {
+        break;
+      }
+    }
+  }
 }
 
 /*___________________________________________________________________________________________________________________*/
@@ -262,7 +652,6 @@ static void CLCD_vSendFallingEdge(void)
 void CLCD_vClearScreen(void)
 {
   CLCD_vSendCommand(CLCD_ClEAR);
-  _delay_ms(10); // wait more than 1.53 ms
 }
 
 /*___________________________________________________________________________________________________________________*/
@@ -287,6 +676,32 @@ void CLCD_vSendString( u8 *Copy_u8PrtStrign)
 
 /*___________________________________________________________________________________________________________________*/
 
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function send a string stored in flash (PROGMEM)
+ *                                            *------------------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_pu8String  --> flash address of the string
+ * return     : nothing
+ */
+
+void CLCD_vSendString_P(const u8 *Copy_pu8String)
+{
+  u8 LOC_u8Char;
+
+  if (Copy_pu8String != NULL)
+  {
+    LOC_u8Char = pgm_read_byte(Copy_pu8String);
+    while (LOC_u8Char != '\0')
+    {
+      CLCD_vSendData(LOC_u8Char);
+      Copy_pu8String++;
+      LOC_u8Char = pgm_read_byte(Copy_pu8String);
+    }
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
  *         	                                      This Function send  integer number to the port which is defined in config.h
  *                                                *----------------------------------------------------------------------------*
@@ -297,31 +712,28 @@ void CLCD_vSendString( u8 *Copy_u8PrtStrign)
 
 void CLCD_vSendIntNumber(s32 Copy_s32Number)
 {
+  CLCD_vSendIntNumberWidth(Copy_s32Number, 0, FMT_PAD_SPACE);
+}
 
-  u32 LOC_u32Reverse = 1;
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function send integer number right aligned in a fixed width field
+ *                                                *----------------------------------------------------------------------------*
+ * Parameters :
+ *		=> Copy_s32Number  --> Number that you want to display
+ *		=> Copy_u8Width    --> field width including the sign (0 ... FMT_MAX_WIDTH), 0 for no padding
+ *		=> Copy_u8Pad      --> FMT_PAD_SPACE or FMT_PAD_ZERO
+ * return     : nothing
+ *
+ * Hint       :-
+ *		A field keeps its length when the value shrinks, so a redraw overwrites the old digits
+ */
 
-  if (Copy_s32Number == 0)
-  {
-    CLCD_vSendData('0');
-  }
-  else
-  {
-    if (Copy_s32Number < 0)
-    {
-      CLCD_vSendData('-');
-      Copy_s32Number = (-1 * Copy_s32Number);
-    }
-    while (Copy_s32Number != 0)
-    {
-      LOC_u32Reverse = (LOC_u32Reverse * 10) + (Copy_s32Number % 10);
-      Copy_s32Number /= 10;
-    }
-    while (LOC_u32Reverse != 1)
-    {
-      CLCD_vSendData((LOC_u32Reverse % 10) + 48);
-      LOC_u32Reverse /= 10;
-    }
-  }
+void CLCD_vSendIntNumberWidth(s32 Copy_s32Number, u8 Copy_u8Width, u8 Copy_u8Pad)
+{
+  u8 LOC_au8Text[FMT_BUFFER_SIZE];
+
+  FMT_u8Signed(Copy_s32Number, Copy_u8Width, Copy_u8Pad, LOC_au8Text);
+  CLCD_vSendString(LOC_au8Text);
 }
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -344,7 +756,7 @@ void CLCD_vSendFloatNumber(f64 Copy_f64Number)
   if ((s64)Copy_f64Number != 0)
   {
     CLCD_vSendData('.');
-    CLCD_vSendIntNumber((s32)Copy_f64Number);
+    CLCD_vSendIntNumberWidth((s32)Copy_f64Number, 4, FMT_PAD_ZERO); // 0.05 is ".0500", not ".500"
   }
 }
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -387,7 +799,6 @@ void CLCD_vSetPosition(u8 Copy_u8ROW, u8 Copy_u8Col)
   }
 
   CLCD_vSendCommand(LOC_u8Data);
-  _delay_ms(1);
 }
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -438,7 +849,6 @@ void CLCD_vSendExtraChar(u8 Copy_u8Row, u8 Copy_u8Col)
 void CLCD_voidShiftDisplayRight(void)
 {
   CLCD_vSendCommand(CLCD_SHIFT_DISPLAY_RIGHT);
-  _delay_ms(1);
 }
 
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
@@ -450,8 +860,46 @@ void CLCD_voidShiftDisplayRight(void)
 void CLCD_voidShiftDisplayLeft(void)
 {
   CLCD_vSendCommand(CLCD_SHIFT_DISPLAY_LEFT);
-  _delay_ms(1);
 }
 
+/*___________________________________________________________________________________________________________________*/
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function starts a frame, the LCD is not written until the frame ends
+ *                                                *---------------------------------------------------------------------------*
+ * Parameters : nothing
+ * return     : nothing
+ *
+ * Hint       :-
+ *		Frames nest, only the outermost CLCD_vEndFrame flushes
+ *		Do not wait for input inside a frame, the echo would not show
+ */
+void CLCD_vBeginFrame(void)
+{
+  CLCD_u8FrameDepth++;
+}
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      This Function ends a frame and sends only the cells that changed
+ *                                                *---------------------------------------------------------------------------*
+ * Parameters : nothing
+ * return     : nothing
+ *
+ * Hint       :-
+ *		In CLCD_REFRESH_ASYNC it returns at once, the refresh tick sends the cells
+ */
+void CLCD_vEndFrame(void)
+{
+  if (CLCD_u8FrameDepth > 0)
+  {
+    CLCD_u8FrameDepth--;
+#if CLCD_REFRESH == CLCD_REFRESH_SYNC
+    if (CLCD_u8FrameDepth == 0)
+    {
+      CLCD_vFlush();
+    }
+#endif
+  }
+}
 
 //<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    END    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -10,4 +10,10 @@
 #ifndef EEPROM_CONFIG_H_
 #define EEPROM_CONFIG_H_
 
+/* Number of pending jobs the asynchronous writer can hold
+ * Options :-
+ *      1 .. 255
+ */
+#define EEPROM_QUEUE_SIZE        8
+
 #endif /* EEPROM_CONFIG_H_ */
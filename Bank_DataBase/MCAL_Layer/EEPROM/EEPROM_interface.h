@@ -12,6 +12,24 @@
 
 void EEPROM_vWrite         (u16 address, u8 data);
 
+void EEPROM_vUpdate        (u16 address, u8 data);
+
 u8   EEPROM_vRead          (u16 address         );
 
+void EEPROM_vReadBlock     (u16 Copy_u16Address, u8 *Copy_pu8Data, u16 Copy_u16Size      );
+
+void EEPROM_vWriteBlock    (u16 Copy_u16Address, const u8 *Copy_pu8Data, u16 Copy_u16Size);
+
+/* Read / write a whole object (struct, array) at the given address */
+#define EEPROM_vReadStruct(Copy_u16Address, Copy_pObject)   EEPROM_vReadBlock ((Copy_u16Address), (u8 *)(Copy_pObject), sizeof(*(Copy_pObject)))
+#define EEPROM_vWriteStruct(Copy_u16Address, Copy_pObject)  EEPROM_vWriteBlock((Copy_u16Address), (const u8 *)(Copy_pObject), sizeof(*(Copy_pObject)))
+
+u8   EEPROM_u8WriteBufferAsynch (u16 Copy_u16Address, const u8 *Copy_pu8Data, u16 Copy_u16Size, void (*NotificationFunc)(void));
+
+u8   EEPROM_u8GetState     (void                );
+
+/* Wait for the queued asynchronous writes (every read / write above flushes first).
+ * Safe with the global interrupt disabled, in an ISR or a notification: the queue is then written by polling */
+void EEPROM_vFlush         (void                );
+
 #endif /* EEPROM_INTERFACE_H_ */
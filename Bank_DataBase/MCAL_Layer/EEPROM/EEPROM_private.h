@@ -23,4 +23,13 @@
 #define EECR_EEMWE  2
 #define EECR_EERIE  3
 
+/* One pending asynchronous write */
+typedef struct
+{
+  u16       Address;                  /* First EEPROM address                  */
+  const u8 *Data;                     /* Source buffer, read when written      */
+  u16       Size;                     /* Number of bytes                       */
+  void    (*NotificationFunc)(void);  /* Called from the ISR when done, or NULL */
+} EEPROM_Job_t;
+
 #endif /* EEPROM_PRIVATE_H_ */
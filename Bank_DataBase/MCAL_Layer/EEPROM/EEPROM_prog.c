@@ -14,6 +14,27 @@
 #include "EEPROM_private.h"
 #include "EEPROM_config.h"
 
+#include "../GIE/GIE_interface.h"
+
+#if (EEPROM_QUEUE_SIZE < 1) || (EEPROM_QUEUE_SIZE > 255)
+#error "Wrong EEPROM_QUEUE_SIZE config"
+#endif
+
+/*Queue of pending asynchronous writes, drained by the EEPROM ready ISR*/
+static EEPROM_Job_t EEPROM_QueueJobs[EEPROM_QUEUE_SIZE];
+
+/*Index of the job being written and number of pending jobs*/
+static volatile u8 EEPROM_u8QueueHead  = 0;
+static volatile u8 EEPROM_u8QueueCount = 0;
+
+/*Index of the next byte of the head job*/
+static volatile u16 EEPROM_u16JobIndex = 0;
+
+/*Global flag for the EEPROM Busy State*/
+static volatile u8 EEPROM_u8State = IDLE;
+
+static void EEPROM_vServeQueue(void);
+
 /*___________________________________________________________________________________________________________________*/
 
 /*
@@ -21,31 +42,59 @@ Function Name        : EEPROM_write
 Function Returns     : void
 Function Arguments   : unsigned short address, unsigned char data
 Function Description :  write one byte to the given  address.
+                        pending asynchronous writes are completed first to keep the write order.
 */
 void EEPROM_vWrite(u16 address, u8 data)
 {
+  u8 Local_u8SREG;
+
+  EEPROM_vFlush();
+
   /*set up address register*/
   EEAR_REG = address;
   /*set up data register*/
   EEDR_REG = data;
+  /*EEWE must follow EEMWE within four cycles, no interrupt may come in between*/
+  Local_u8SREG = GIE_u8EnterCritical();
   /*write logical one to EEMWE*/
   SET_BIT(EECR_REG, EECR_EEMWE);
   /*start EEPROM write by setting EEWE*/
   SET_BIT(EECR_REG, EECR_EEWE );
+  GIE_vExitCritical(Local_u8SREG);
   /* wait for completion of  write operation*/
   while (READ_BIT(EECR_REG, EECR_EEWE) == 1);
 }
 
 /*___________________________________________________________________________________________________________________*/
 
+/*
+Function Name        : EEPROM_update
+Function Returns     : void
+Function Arguments   : unsigned short address, unsigned char data
+Function Description :  write one byte to the given address only if it holds a different value
+                        (a read costs a few cycles, a write ~8.5 ms and one erase/write cycle).
+*/
+void EEPROM_vUpdate(u16 address, u8 data)
+{
+  if (EEPROM_vRead(address) != data)
+  {
+    EEPROM_vWrite(address, data);
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
 /*
 Function Name        : EEPROM_read
 Function Returns     : unsigned char
 Function Arguments   :  unsigned short address
 Function Description :  read one byte from the given  address.
+                        pending asynchronous writes are completed first so the read sees them.
 */
 u8 EEPROM_vRead(u16 address)
 {
+  EEPROM_vFlush();
+
   /*set up address register*/
   EEARL_REG = (char)address;
   EEARH_REG = (char)(address >> 8);
@@ -53,4 +102,236 @@ u8 EEPROM_vRead(u16 address)
   SET_BIT(EECR_REG, EECR_EERE);
   /*return data from data register*/
   return EEDR_REG;
-}
\ No newline at end of file
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+Function Name        : EEPROM_vReadBlock
+Function Returns     : void
+Function Arguments   : unsigned short address, pointer to the destination, number of bytes
+Function Description :  read a run of sequential bytes starting at the given address.
+                        the queue is flushed once for the whole block, then each byte only costs
+                        an address step and a read strobe.
+*/
+void EEPROM_vReadBlock(u16 Copy_u16Address, u8 *Copy_pu8Data, u16 Copy_u16Size)
+{
+  EEPROM_vFlush();
+
+  for (u16 Local_u16Index = 0; Local_u16Index < Copy_u16Size; Local_u16Index++)
+  {
+    /*set up address register*/
+    EEAR_REG = Copy_u16Address++;
+    /*start EEPROM read by setting EERE*/
+    SET_BIT(EECR_REG, EECR_EERE);
+    Copy_pu8Data[Local_u16Index] = EEDR_REG;
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+Function Name        : EEPROM_vWriteBlock
+Function Returns     : void
+Function Arguments   : unsigned short address, pointer to the source, number of bytes
+Function Description :  write a run of sequential bytes starting at the given address and wait
+                        for the last one. bytes already holding their value are skipped.
+*/
+void EEPROM_vWriteBlock(u16 Copy_u16Address, const u8 *Copy_pu8Data, u16 Copy_u16Size)
+{
+  u8 Local_u8SREG;
+
+  EEPROM_vFlush();
+
+  for (u16 Local_u16Index = 0; Local_u16Index < Copy_u16Size; Local_u16Index++, Copy_u16Address++)
+  {
+    /* wait for completion of the previous write operation*/
+    while (READ_BIT(EECR_REG, EECR_EEWE) == 1);
+
+    /*read the old value, unchanged bytes cost no write cycle*/
+    EEAR_REG = Copy_u16Address;
+    SET_BIT(EECR_REG, EECR_EERE);
+    if (EEDR_REG == Copy_pu8Data[Local_u16Index])
+    {
+      continue;
+    }
+
+    EEDR_REG = Copy_pu8Data[Local_u16Index];
+    Local_u8SREG = GIE_u8EnterCritical();
+    SET_BIT(EECR_REG, EECR_EEMWE);
+    SET_BIT(EECR_REG, EECR_EEWE );
+    GIE_vExitCritical(Local_u8SREG);
+  }
+
+  /* wait for completion of the last write operation*/
+  while (READ_BIT(EECR_REG, EECR_EEWE) == 1);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+Function Name        : EEPROM_u8WriteBufferAsynch
+Function Returns     : Error status (OK, NULL_POINTER, BUSY_STATE if the queue is full)
+Function Arguments   : unsigned short address, pointer to the data, number of bytes, notification function
+Function Description :  queue a buffer to be written by the EEPROM ready interrupt and return at once.
+                        the buffer is read when each byte is written so it must stay valid until the
+                        notification, bytes already holding their value are skipped.
+                        queuing the same (address, data, size) again while it still waits is merged,
+                        unless a later job overlaps it.
+                        the queue drains in the background only while the global interrupt is enabled,
+                        with it disabled the jobs wait for the next flush.
+*/
+u8 EEPROM_u8WriteBufferAsynch(u16 Copy_u16Address, const u8 *Copy_pu8Data, u16 Copy_u16Size, void (*NotificationFunc)(void))
+{
+  u8 Local_u8ErrorState = OK;
+  u8 Local_u8SREG;
+  u8 Local_u8Job;
+
+  if (Copy_pu8Data == NULL)
+  {
+    return NULL_POINTER;
+  }
+
+  Local_u8SREG = GIE_u8EnterCritical();
+
+  /*A waiting job (not the head, it may be half written) already covers this write,
+    as long as no later job writes any of the same addresses*/
+  for (u8 Local_u8Index = EEPROM_u8QueueCount; Local_u8Index > 1; Local_u8Index--)
+  {
+    Local_u8Job = (EEPROM_u8QueueHead + Local_u8Index - 1) % EEPROM_QUEUE_SIZE;
+    if ((EEPROM_QueueJobs[Local_u8Job].Address == Copy_u16Address) &&
+        (EEPROM_QueueJobs[Local_u8Job].Data == Copy_pu8Data) &&
+        (EEPROM_QueueJobs[Local_u8Job].Size == Copy_u16Size) &&
+        (EEPROM_QueueJobs[Local_u8Job].NotificationFunc == NotificationFunc))
+    {
+      GIE_vExitCritical(Local_u8SREG);
+      return OK;
+    }
+    if ((EEPROM_QueueJobs[Local_u8Job].Address < Copy_u16Address + Copy_u16Size) &&
+        (Copy_u16Address < EEPROM_QueueJobs[Local_u8Job].Address + EEPROM_QueueJobs[Local_u8Job].Size))
+    {
+      break;
+    }
+  }
+
+  if (EEPROM_u8QueueCount < EEPROM_QUEUE_SIZE)
+  {
+    Local_u8Job = (EEPROM_u8QueueHead + EEPROM_u8QueueCount) % EEPROM_QUEUE_SIZE;
+    EEPROM_QueueJobs[Local_u8Job].Address = Copy_u16Address;
+    EEPROM_QueueJobs[Local_u8Job].Data = Copy_pu8Data;
+    EEPROM_QueueJobs[Local_u8Job].Size = Copy_u16Size;
+    EEPROM_QueueJobs[Local_u8Job].NotificationFunc = NotificationFunc;
+    EEPROM_u8QueueCount++;
+
+    /*EEPROM is now Busy*/
+    EEPROM_u8State = BUSY;
+
+    /*EEPROM Ready Interrupt Enable*/
+    SET_BIT(EECR_REG, EECR_EERIE);
+  }
+  else
+  {
+    Local_u8ErrorState = BUSY_STATE;
+  }
+
+  GIE_vExitCritical(Local_u8SREG);
+
+  return Local_u8ErrorState;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+Function Name        : EEPROM_u8GetState
+Function Returns     : IDLE or BUSY
+Function Arguments   : void
+Function Description :  BUSY while asynchronous writes are still queued.
+*/
+u8 EEPROM_u8GetState(void)
+{
+  return EEPROM_u8State;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+Function Name        : EEPROM_vFlush
+Function Returns     : void
+Function Arguments   : void
+Function Description :  wait until every queued asynchronous write has been written.
+                        with the global interrupt disabled (cli, inside an ISR or a notification)
+                        the ready ISR can not run, so the queue is written here by polling EEWE.
+*/
+void EEPROM_vFlush(void)
+{
+  while (EEPROM_u8State != IDLE)
+  {
+    if (GIE_u8IsEnabled() == 0)
+    {
+      /* wait for completion of the current write operation, then serve the queue as the ISR would*/
+      while (READ_BIT(EECR_REG, EECR_EEWE) == 1);
+      EEPROM_vServeQueue();
+    }
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*Write the next changed byte of the head job, or complete it.
+  Called by the ready ISR, or by the flush when the global interrupt is disabled*/
+static void EEPROM_vServeQueue(void)
+{
+  EEPROM_Job_t *Local_pJob = &EEPROM_QueueJobs[EEPROM_u8QueueHead];
+  void (*Local_pvNotificationFunc)(void);
+  u16 Local_u16Address;
+  u8 Local_u8Data;
+
+  while (EEPROM_u16JobIndex < Local_pJob->Size)
+  {
+    Local_u16Address = Local_pJob->Address + EEPROM_u16JobIndex;
+    Local_u8Data = Local_pJob->Data[EEPROM_u16JobIndex];
+    EEPROM_u16JobIndex++;
+
+    /*Read the old value, unchanged bytes cost no write cycle*/
+    EEAR_REG = Local_u16Address;
+    SET_BIT(EECR_REG, EECR_EERE);
+    if (EEDR_REG != Local_u8Data)
+    {
+      /*Start writing the byte, the ISR comes back once it is done*/
+      EEDR_REG = Local_u8Data;
+      SET_BIT(EECR_REG, EECR_EEMWE);
+      SET_BIT(EECR_REG, EECR_EEWE );
+      return;
+    }
+  }
+
+  /*Job Complete*/
+  Local_pvNotificationFunc = Local_pJob->NotificationFunc;
+  EEPROM_u16JobIndex = 0;
+  EEPROM_u8QueueHead = (EEPROM_u8QueueHead + 1) % EEPROM_QUEUE_SIZE;
+  EEPROM_u8QueueCount--;
+
+  if (EEPROM_u8QueueCount == 0)
+  {
+    /*EEPROM is now IDLE*/
+    EEPROM_u8State = IDLE;
+
+    /*EEPROM Ready Interrupt Disable*/
+    CLR_BIT(EECR_REG, EECR_EERIE);
+  }
+
+  /*Call Notification Function*/
+  if (Local_pvNotificationFunc != NULL)
+  {
+    Local_pvNotificationFunc();
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/* ISR for EEPROM ready */
+void __vector_17(void) __attribute__((signal));
+void __vector_17(void)
+{
+  EEPROM_vServeQueue();
+}
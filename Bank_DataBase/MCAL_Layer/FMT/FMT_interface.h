@@ -0,0 +1,29 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    FMT_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : FMT
+ *
+ */
+
+#ifndef FMT_INTERFACE_H_
+#define FMT_INTERFACE_H_
+
+/*Longest text : sign and 10 digits, a wider field is cut to this width*/
+#define FMT_MAX_WIDTH                       11
+#define FMT_BUFFER_SIZE                     (FMT_MAX_WIDTH + 1)
+
+/*Fill of a field wider than the number*/
+#define FMT_PAD_SPACE                       ' '     // "   42", "  -42"
+#define FMT_PAD_ZERO                        '0'     // "00042", "-0042"
+
+/*
+ * Numbers are written to a FMT_BUFFER_SIZE buffer, right aligned in Copy_u8Width characters
+ * (0 for no padding) and '\0' terminated, the return value is the text length
+ * Digits come from subtracting powers of ten, no 32 bit division is called
+ */
+u8   FMT_u8Unsigned                         (u32 Copy_u32Number, u8 Copy_u8Width, u8 Copy_u8Pad, u8 *Copy_pu8Buffer      );
+u8   FMT_u8Signed                           (s32 Copy_s32Number, u8 Copy_u8Width, u8 Copy_u8Pad, u8 *Copy_pu8Buffer      );
+
+#endif /* FMT_INTERFACE_H_ */
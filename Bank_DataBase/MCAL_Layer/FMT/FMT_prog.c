@@ -0,0 +1,183 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    FMT_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : FMT
+ *
+ */
+
+#include <avr/pgmspace.h>
+
+#include "../../APP_Layer/STD_TYPES.h"
+#include "../../APP_Layer/STD_MACROS.h"
+
+#include "FMT_interface.h"
+
+/*Powers of ten above the 16 bit range, the rest of a number is converted with 16 bit subtractions*/
+static const u32 FMT_au32Powers[] PROGMEM = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL};
+static const u16 FMT_au16Powers[] = {10000, 1000, 100, 10};
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function writes the digits of a number, without sign or padding
+ * Parameters :
+ *            => Copy_u32Number  : number to convert
+ *            => Copy_pu8Digits  : receives up to 10 digits, not terminated
+ * return     :  Number of digits
+ */
+static u8 FMT_u8Digits(u32 Copy_u32Number, u8 *Copy_pu8Digits)
+{
+  u8 Local_u8Length = 0;
+  u8 Local_u8Index;
+  u8 Local_u8Digit;
+  u32 Local_u32Power;
+  u16 Local_u16Number;
+
+  /*Upper digits, only for numbers above 99999, at most 9 subtractions each*/
+  if (Copy_u32Number >= 100000UL)
+  {
+    for (Local_u8Index = 0; Local_u8Index < (sizeof(FMT_au32Powers) / sizeof(FMT_au32Powers[0])); Local_u8Index++)
+    {
+      Local_u32Power = pgm_read_dword(&FMT_au32Powers[Local_u8Index]);
+      Local_u8Digit = '0';
+      while (Copy_u32Number >= Local_u32Power)
+      {
+        Copy_u32Number -= Local_u32Power;
+        Local_u8Digit++;
+      }
+      if ((Local_u8Length != 0) || (Local_u8Digit != '0'))
+      {
+        Copy_pu8Digits[Local_u8Length++] = Local_u8Digit;
+      }
+    }
+  }
+
+  /*Lower 5 digits in 16 bits, what is left is always below 100000*/
+  if (Copy_u32Number >= 65536UL)
+  {
+    /*Only 65536 ... 99999 does not fit in 16 bits, its first digit is 6 ... 9*/
+    Local_u8Digit = '0' + 6;
+    Copy_u32Number -= 60000UL;
+    while (Copy_u32Number >= 10000UL)
+    {
+      Copy_u32Number -= 10000UL;
+      Local_u8Digit++;
+    }
+    Copy_pu8Digits[Local_u8Length++] = Local_u8Digit;
+    Local_u8Index = 1;
+  }
+  else
+  {
+    Local_u8Index = 0;
+  }
+  Local_u16Number = (u16)Copy_u32Number;
+
+  for (; Local_u8Index < (sizeof(FMT_au16Powers) / sizeof(FMT_au16Powers[0])); Local_u8Index++)
+  {
+    Local_u8Digit = '0';
+    while (Local_u16Number >= FMT_au16Powers[Local_u8Index])
+    {
+      Local_u16Number -= FMT_au16Powers[Local_u8Index];
+      Local_u8Digit++;
+    }
+    if ((Local_u8Length != 0) || (Local_u8Digit != '0'))
+    {
+      Copy_pu8Digits[Local_u8Length++] = Local_u8Digit;
+    }
+  }
+  Copy_pu8Digits[Local_u8Length++] = '0' + (u8)Local_u16Number;
+
+  return Local_u8Length;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function writes sign, padding and digits right aligned in the field
+ * Parameters :
+ *            => Copy_u32Magnitude : number without its sign
+ *            => Copy_u8Negative   : 1 to write a '-'
+ *            => Copy_u8Width      : field width, 0 for no padding
+ *            => Copy_u8Pad        : FMT_PAD_SPACE or FMT_PAD_ZERO
+ *            => Copy_pu8Buffer    : FMT_BUFFER_SIZE bytes
+ * return     :  Text length
+ */
+static u8 FMT_u8Field(u32 Copy_u32Magnitude, u8 Copy_u8Negative, u8 Copy_u8Width, u8 Copy_u8Pad, u8 *Copy_pu8Buffer)
+{
+  u8 Local_au8Digits[10];
+  u8 Local_u8Digits = FMT_u8Digits(Copy_u32Magnitude, Local_au8Digits);
+  u8 Local_u8Length = 0;
+  u8 Local_u8Index;
+
+  if (Copy_pu8Buffer == NULL)
+  {
+    return 0;
+  }
+
+  if (Copy_u8Width > FMT_MAX_WIDTH)
+  {
+    Copy_u8Width = FMT_MAX_WIDTH;
+  }
+
+  /*"  -42" puts the sign after the spaces, "-0042" before the zeros*/
+  if ((Copy_u8Negative) && (Copy_u8Pad == FMT_PAD_ZERO))
+  {
+    Copy_pu8Buffer[Local_u8Length++] = '-';
+    Copy_u8Negative = 0;
+  }
+  while ((Local_u8Length + Copy_u8Negative + Local_u8Digits) < Copy_u8Width)
+  {
+    Copy_pu8Buffer[Local_u8Length++] = Copy_u8Pad;
+  }
+  if (Copy_u8Negative)
+  {
+    Copy_pu8Buffer[Local_u8Length++] = '-';
+  }
+
+  for (Local_u8Index = 0; Local_u8Index < Local_u8Digits; Local_u8Index++)
+  {
+    Copy_pu8Buffer[Local_u8Length++] = Local_au8Digits[Local_u8Index];
+  }
+  Copy_pu8Buffer[Local_u8Length] = '\0';
+
+  return Local_u8Length;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function writes an unsigned number as text
+ * Parameters :
+ *            => Copy_u32Number  : number to write
+ *            => Copy_u8Width    : field width, 0 for no padding
+ *            => Copy_u8Pad      : FMT_PAD_SPACE or FMT_PAD_ZERO
+ *            => Copy_pu8Buffer  : FMT_BUFFER_SIZE bytes
+ * return     :  Text length
+ */
+u8 FMT_u8Unsigned(u32 Copy_u32Number, u8 Copy_u8Width, u8 Copy_u8Pad, u8 *Copy_pu8Buffer)
+{
+  return FMT_u8Field(Copy_u32Number, 0, Copy_u8Width, Copy_u8Pad, Copy_pu8Buffer);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function writes a signed number as text
+ * Parameters :
+ *            => Copy_s32Number  : number to write
+ *            => Copy_u8Width    : field width including the sign, 0 for no padding
+ *            => Copy_u8Pad      : FMT_PAD_SPACE or FMT_PAD_ZERO
+ *            => Copy_pu8Buffer  : FMT_BUFFER_SIZE bytes
+ * return     :  Text length
+ */
+u8 FMT_u8Signed(s32 Copy_s32Number, u8 Copy_u8Width, u8 Copy_u8Pad, u8 *Copy_pu8Buffer)
+{
+  if (Copy_s32Number < 0)
+  {
+    /*Unsigned negation also holds for the smallest s32*/
+    return FMT_u8Field(0UL - (u32)Copy_s32Number, 1, Copy_u8Width, Copy_u8Pad, Copy_pu8Buffer);
+  }
+  return FMT_u8Field((u32)Copy_s32Number, 0, Copy_u8Width, Copy_u8Pad, Copy_pu8Buffer);
+}
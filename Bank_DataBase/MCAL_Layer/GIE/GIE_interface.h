@@ -0,0 +1,20 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    GIE_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : GIE
+ *
+ */
+
+#ifndef GIE_INTERFACE_H_
+#define GIE_INTERFACE_H_
+
+void GIE_vEnable                   (void                  );
+void GIE_vDisable                  (void                  );
+u8   GIE_u8IsEnabled               (void                  );
+
+u8   GIE_u8EnterCritical           (void                  );
+void GIE_vExitCritical             (u8 Copy_u8State       );
+
+#endif /* GIE_INTERFACE_H_ */
@@ -0,0 +1,17 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    GIE_private.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : GIE
+ *
+ */
+
+#ifndef GIE_PRIVATE_H_
+#define GIE_PRIVATE_H_
+
+/* Status Register */
+#define SREG_REG   *((volatile u8 *)0x5F)
+#define SREG_I     7
+
+#endif /* GIE_PRIVATE_H_ */
@@ -0,0 +1,78 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    GIE_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : GIE
+ *
+ */
+
+#include "../../APP_Layer/STD_TYPES.h"
+#include "../../APP_Layer/STD_MACROS.h"
+
+#include "GIE_interface.h"
+#include "GIE_private.h"
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function enable the global interrupt (I bit of SREG)
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void GIE_vEnable(void)
+{
+  SET_BIT(SREG_REG, SREG_I);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function disable the global interrupt (I bit of SREG)
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void GIE_vDisable(void)
+{
+  CLR_BIT(SREG_REG, SREG_I);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function tells if the global interrupt is enabled (false inside ISRs)
+ * Parameters :  Nothing
+ * return     :  1 if enabled, 0 if disabled
+ */
+u8 GIE_u8IsEnabled(void)
+{
+  return READ_BIT(SREG_REG, SREG_I);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function disable the global interrupt and return the previous SREG
+ *              to be restored by GIE_vExitCritical (safe to nest, safe before GIE_vEnable)
+ * Parameters :  Nothing
+ * return     :  SREG value before disabling
+ */
+u8 GIE_u8EnterCritical(void)
+{
+  u8 Local_u8State = SREG_REG;
+  CLR_BIT(SREG_REG, SREG_I);
+  return Local_u8State;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function restore the SREG saved by GIE_u8EnterCritical
+ * Parameters :
+ *      => Copy_u8State --> value returned by GIE_u8EnterCritical
+ * return     :  Nothing
+ */
+void GIE_vExitCritical(u8 Copy_u8State)
+{
+  SREG_REG = Copy_u8State;
+}
@@ -0,0 +1,25 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    TIMER_config.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : TIMER
+ *
+ */
+
+#ifndef TIMER_CONFIG_H_
+#define TIMER_CONFIG_H_
+
+/*Set System Frequency*/
+#define TIMER_SYSTEM_FREQUENCY                  8000000UL
+
+/* Timer0 clock prescaler, the compare value for a 1 ms tick is derived from it
+ * Options :-
+ *      TIMER_PRESCALER_8
+ *      TIMER_PRESCALER_64
+ *      TIMER_PRESCALER_256
+ *      TIMER_PRESCALER_1024
+ */
+#define TIMER_PRESCALER                         TIMER_PRESCALER_64
+
+#endif /* TIMER_CONFIG_H_ */
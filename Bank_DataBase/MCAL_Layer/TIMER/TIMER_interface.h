@@ -0,0 +1,33 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    TIMER_interface.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : TIMER
+ *
+ */
+
+#ifndef TIMER_INTERFACE_H_
+#define TIMER_INTERFACE_H_
+
+#define TIMER_PRESCALER_8                   8UL
+#define TIMER_PRESCALER_64                  64UL
+#define TIMER_PRESCALER_256                 256UL
+#define TIMER_PRESCALER_1024                1024UL
+
+/* Timer0 counts one tick per millisecond, deadlines are tick values and stay valid across the
+   counter wrap as long as a timeout is shorter than 24 days */
+void TIMER_vInit                            (void                                                                          );
+u32  TIMER_u32GetMillis                     (void                                                                          );
+u32  TIMER_u32Deadline                      (u32 Copy_u32TimeoutMs                                                         );
+u8   TIMER_u8IsExpired                      (u32 Copy_u32Deadline                                                          );
+
+/* Called from the Timer0 ISR every tick with interrupts disabled, it must return within a few tens of us */
+void TIMER_vSetTickCallBack                 (void (*Copy_pvTickFunc)(void)                                                 );
+
+/* Timer1 counts CPU cycles between start and stop (measurements only), wraps after 2^32 cycles */
+void TIMER_vCycleStart                      (void                                                                          );
+u32  TIMER_u32GetCycles                     (void                                                                          );
+void TIMER_vCycleStop                       (void                                                                          );
+
+#endif /* TIMER_INTERFACE_H_ */
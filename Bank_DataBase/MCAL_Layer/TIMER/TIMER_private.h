@@ -0,0 +1,48 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    TIMER_private.h    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : TIMER
+ *
+ */
+
+#ifndef TIMER_PRIVATE_H_
+#define TIMER_PRIVATE_H_
+
+/* Timer0 Control Register */
+#define TCCR0_REG     *((volatile u8 *)0x53)
+#define TCCR0_FOC0    7
+#define TCCR0_WGM00   6
+#define TCCR0_COM01   5
+#define TCCR0_COM00   4
+#define TCCR0_WGM01   3
+#define TCCR0_CS02    2
+#define TCCR0_CS01    1
+#define TCCR0_CS00    0
+
+/* Timer0 Counter and Output Compare Registers */
+#define TCNT0_REG     *((volatile u8 *)0x52)
+#define OCR0_REG      *((volatile u8 *)0x5C)
+
+/* Timer1 Control Registers and Counter */
+#define TCCR1A_REG    *((volatile u8 *)0x4F)
+#define TCCR1B_REG    *((volatile u8 *)0x4E)
+#define TCCR1B_CS10   0
+#define TCNT1_REG     *((volatile u16 *)0x4C)
+
+/* Timer Interrupt Mask Register */
+#define TIMSK_REG     *((volatile u8 *)0x59)
+#define TIMSK_TOIE1   2
+#define TIMSK_OCIE0   1
+
+/* Timer Interrupt Flag Register */
+#define TIFR_REG      *((volatile u8 *)0x58)
+#define TIFR_TOV1     2
+#define TIFR_OCF0     1
+
+/* Compare value giving one compare match per millisecond in CTC mode */
+#define TIMER_TICK_FREQUENCY      1000UL
+#define TIMER_OCR0_VALUE          ((TIMER_SYSTEM_FREQUENCY) / ((TIMER_PRESCALER) * TIMER_TICK_FREQUENCY) - 1UL)
+
+#endif /* TIMER_PRIVATE_H_ */
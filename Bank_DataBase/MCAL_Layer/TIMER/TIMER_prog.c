@@ -0,0 +1,213 @@
+/*
+ *<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<    TIMER_prog.c    >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+ *
+ *  Author : Abdallah Abdelmoemen Shehawey
+ *  Layer  : MCAL
+ *  SWC    : TIMER
+ *
+ */
+
+#include "../../APP_Layer/STD_TYPES.h"
+#include "../../APP_Layer/STD_MACROS.h"
+
+#include "../GIE/GIE_interface.h"
+
+#include "TIMER_interface.h"
+#include "TIMER_private.h"
+#include "TIMER_config.h"
+
+#if (TIMER_PRESCALER == TIMER_PRESCALER_8)
+#define TIMER_CLOCK_SELECT        0x02
+#elif (TIMER_PRESCALER == TIMER_PRESCALER_64)
+#define TIMER_CLOCK_SELECT        0x03
+#elif (TIMER_PRESCALER == TIMER_PRESCALER_256)
+#define TIMER_CLOCK_SELECT        0x04
+#elif (TIMER_PRESCALER == TIMER_PRESCALER_1024)
+#define TIMER_CLOCK_SELECT        0x05
+#else
+#error "Wrong TIMER_PRESCALER config"
+#endif
+
+#if (TIMER_OCR0_VALUE > 255UL) || (((TIMER_SYSTEM_FREQUENCY) % ((TIMER_PRESCALER) * TIMER_TICK_FREQUENCY)) != 0)
+#error "TIMER_PRESCALER can not give an exact 1 ms tick from TIMER_SYSTEM_FREQUENCY"
+#endif
+
+/*Milliseconds since TIMER_vInit, counted by the compare match ISR*/
+static volatile u32 TIMER_u32Ticks = 0;
+
+/*Run by the compare match ISR after the tick is counted, NULL for none*/
+static void (*volatile TIMER_pvTickFunc)(void) = NULL;
+
+/*Upper half of the cycle counter, counted by the Timer1 overflow ISR*/
+static volatile u16 TIMER_u16CycleOverflows = 0;
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function starts Timer0 in CTC mode with a compare match interrupt every millisecond
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void TIMER_vInit(void)
+{
+  TCCR0_REG = 0;
+  TCNT0_REG = 0;
+  OCR0_REG = (u8)TIMER_OCR0_VALUE;
+  TIFR_REG = (1 << TIFR_OCF0);
+  SET_BIT(TIMSK_REG, TIMSK_OCIE0);
+
+  /*CTC mode, OC0 disconnected, the clock starts last*/
+  TCCR0_REG = (1 << TCCR0_WGM01) | TIMER_CLOCK_SELECT;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function returns the milliseconds counted since TIMER_vInit
+ *              with interrupts disabled a pending compare match is counted here, so waits inside
+ *              critical sections or other ISRs still time out
+ * Parameters :  Nothing
+ * return     :  Milliseconds, wraps after 49 days
+ */
+u32 TIMER_u32GetMillis(void)
+{
+  u32 Local_u32Ticks;
+  u8 Local_u8WasEnabled = GIE_u8IsEnabled();
+  u8 Local_u8State = GIE_u8EnterCritical();
+
+  if ((Local_u8WasEnabled == 0) && (READ_BIT(TIFR_REG, TIFR_OCF0)))
+  {
+    /*Writing one clears the flag, so the ISR does not count this tick again*/
+    TIFR_REG = (1 << TIFR_OCF0);
+    TIMER_u32Ticks++;
+  }
+  Local_u32Ticks = TIMER_u32Ticks;
+
+  GIE_vExitCritical(Local_u8State);
+
+  return Local_u32Ticks;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function returns the deadline for a timeout starting now
+ * Parameters :
+ *            => Copy_u32TimeoutMs : timeout in milliseconds (below 2^31)
+ * return     :  Deadline to pass to TIMER_u8IsExpired
+ */
+u32 TIMER_u32Deadline(u32 Copy_u32TimeoutMs)
+{
+  return TIMER_u32GetMillis() + Copy_u32TimeoutMs;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function checks a deadline, the signed difference keeps it right across the counter wrap
+ * Parameters :
+ *            => Copy_u32Deadline : value returned by TIMER_u32Deadline
+ * return     :  1 once the deadline is reached, 0 before
+ */
+u8 TIMER_u8IsExpired(u32 Copy_u32Deadline)
+{
+  return ((s32)(TIMER_u32GetMillis() - Copy_u32Deadline) >= 0) ? 1 : 0;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sets the function run by the Timer0 ISR every millisecond
+ * Parameters :
+ *            => Copy_pvTickFunc : function to run, NULL to stop
+ * return     :  Nothing
+ */
+void TIMER_vSetTickCallBack(void (*Copy_pvTickFunc)(void))
+{
+  u8 Local_u8State = GIE_u8EnterCritical(); // the pointer is written one byte at a time
+  TIMER_pvTickFunc = Copy_pvTickFunc;
+  GIE_vExitCritical(Local_u8State);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function starts Timer1 from zero at the CPU clock to count cycles
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void TIMER_vCycleStart(void)
+{
+  u8 Local_u8State = GIE_u8EnterCritical();
+
+  /*Normal mode, OC1A/OC1B disconnected*/
+  TCCR1A_REG = 0;
+  TCCR1B_REG = 0;
+  TCNT1_REG = 0;
+  TIMER_u16CycleOverflows = 0;
+  TIFR_REG = (1 << TIFR_TOV1);
+  SET_BIT(TIMSK_REG, TIMSK_TOIE1);
+  TCCR1B_REG = (1 << TCCR1B_CS10);
+
+  GIE_vExitCritical(Local_u8State);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function returns the CPU cycles counted since TIMER_vCycleStart
+ * Parameters :  Nothing
+ * return     :  Cycles
+ */
+u32 TIMER_u32GetCycles(void)
+{
+  u8 Local_u8State = GIE_u8EnterCritical();
+  u16 Local_u16Count = TCNT1_REG;
+  u16 Local_u16Overflows = TIMER_u16CycleOverflows;
+
+  /*An overflow not serviced yet belongs to a count read after it*/
+  if ((READ_BIT(TIFR_REG, TIFR_TOV1)) && (Local_u16Count < 0x8000))
+  {
+    Local_u16Overflows++;
+  }
+
+  GIE_vExitCritical(Local_u8State);
+
+  return ((u32)Local_u16Overflows << 16) | Local_u16Count;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function stops the Timer1 cycle counter
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void TIMER_vCycleStop(void)
+{
+  TCCR1B_REG = 0;
+  CLR_BIT(TIMSK_REG, TIMSK_TOIE1);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/* ISR for Timer1 overflow */
+void __vector_9(void) __attribute__((signal));
+void __vector_9(void)
+{
+  TIMER_u16CycleOverflows++;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/* ISR for Timer0 compare match */
+void __vector_10(void) __attribute__((signal));
+void __vector_10(void)
+{
+  TIMER_u32Ticks++;
+
+  if (TIMER_pvTickFunc != NULL)
+  {
+    TIMER_pvTickFunc();
+  }
+}
@@ -15,32 +15,66 @@
 /*Set System Frequency*/
 #define SYSTEM_FREQUENCY                          8000000UL
 
-/*Set Baud Rate*/
+/*Set Baud Rate (the virtual terminal of the Proteus design runs at 9600, change it too before going faster)
+ * at 8 MHz : 9600, 19200, 38400, 76800, 250000 and 500000 are within 0.2 %
+ *            57600 and 115200 are off by 2.1 % and 3.5 %
+ */
 #define USART_BAUD_RATE                           9600UL
 
 /*Set System Speed
  * choose between
- * 1. USART_1X
- * 2. USART_2X  (Double Speed Mode)
+ * 1. USART_AUTO_SPEED  (1X or 2X, whichever gives the lower baud rate error)
+ * 2. USART_1X
+ * 3. USART_2X  (Double Speed Mode)
  */
-#define USART_SYSTEM_SPEED                      USART_1X
+#define USART_SYSTEM_SPEED                      USART_AUTO_SPEED
+
+/*Set the largest allowed baud rate error in 0.1 % steps (asynchronous mode only), the build fails above it*/
+#define USART_BAUD_ERROR_MAX                      20
 
-/*Set Timeout for Your functions*/
-#define USART_u32TIMEOUT                         10000UL
+/*Set Timeout for Your functions in milliseconds (counted by the TIMER tick)*/
+#define USART_u16TIMEOUT_MS                      20
 
 /*Set Multi-Processor Communication mode
  * choose between
  * 1. DISABLE
- * 2. ENABLE
+ * 2. ENABLE  (needs DATA_SIZE_9_BIT and the RX complete interrupt, the 9th bit marks address frames)
  */
 #define USART_MPCM                             DISABLE
 
+/*Set the address of this node on a multi-drop bus (USART_MPCM only), can be changed at run time*/
+#define USART_NODE_ADDRESS                     0x01
+
+/*Set the address every node listens to (USART_MPCM only)*/
+#define USART_BROADCAST_ADDRESS                0xFF
+
 /*Set RX Complete Interrupt Enable
  * choose between
  * 1. DISABLE
- * 2. ENABLE
+ * 2. ENABLE  (received bytes are kept in the RX ring buffer)
+ */
+#define USART_RX_COMPLETE_INTERRUPT          ENABLE
+
+/*Set RX Ring Buffer Size (power of two from 2 to 128)*/
+#define USART_RX_BUFFER_SIZE                 64
+
+/*Set Flow Control, the host is paused when the RX ring buffer fills up (needs both ring buffers)
+ * choose between
+ * 1. USART_FLOW_NONE
+ * 2. USART_FLOW_XON_XOFF  (XON/XOFF bytes are taken out of the input, binary data has to escape them as the HOST frames do)
+ * 3. USART_FLOW_RTS_CTS   (RTS output high asks the host to wait, CTS input high makes us wait)
  */
-#define USART_RX_COMPLETE_INTERRUPT          DISABLE
+#define USART_FLOW_CONTROL                   USART_FLOW_NONE
+
+/*Set the RX ring buffer fill levels that pause and resume the host (leave room for the bytes already on the way)*/
+#define USART_RX_HIGH_WATERMARK              48
+#define USART_RX_LOW_WATERMARK               16
+
+/*Set the RTS output and CTS input pins (USART_FLOW_RTS_CTS only)*/
+#define USART_RTS_PORT                       DIO_PORTD
+#define USART_RTS_PIN                        DIO_PIN4
+#define USART_CTS_PORT                       DIO_PORTD
+#define USART_CTS_PIN                        DIO_PIN5
 
 /*Set TX Complete Interrupt Enable
  * choose between
@@ -52,9 +86,12 @@
 /*Set UDR Empty Interrupt Enable
  * choose between
  * 1. DISABLE
- * 2. ENABLE
+ * 2. ENABLE  (bytes to send are queued in the TX ring buffer and sent by the interrupt)
  */
-#define USART_UDR_EMPTY_INTERRUPT            DISABLE
+#define USART_UDR_EMPTY_INTERRUPT            ENABLE
+
+/*Set TX Ring Buffer Size (power of two from 2 to 128)*/
+#define USART_TX_BUFFER_SIZE                 64
 
 /*Set Receiver Enable
  * choose between
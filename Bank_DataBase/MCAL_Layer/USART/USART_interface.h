@@ -12,6 +12,7 @@
 #ifndef USART_INTERFACE_H_
 #define USART_INTERFACE_H_
 
+#define USART_AUTO_SPEED                    0
 #define USART_1X                            1
 #define USART_2X                            2
 
@@ -33,6 +34,22 @@
 #define XCK_RISING_TX_XCH_FALLING_RX        0
 #define XCK_RISING_RX_XCH_FALLING_TX        1
 
+#define USART_FLOW_NONE                     0
+#define USART_FLOW_XON_XOFF                 1
+#define USART_FLOW_RTS_CTS                  2
+
+#define USART_XON                           0x11
+#define USART_XOFF                          0x13
+
+/*Receive errors counted by the RX complete ISR*/
+typedef struct
+{
+  u16 Frame;                          /* FE, the stop bit was 0               */
+  u16 Overrun;                        /* DOR, UDR was not read in time        */
+  u16 Parity;                         /* PE                                   */
+  u16 Dropped;                        /* the RX ring buffer was full          */
+} USART_Errors_t;
+
 
 void USART_vInit                            (void                                                                          );
 u8   USART_u8SendData                       (u8 Copy_u8Data                                                                );
@@ -40,9 +57,25 @@ u8   USART_u8ReceiveData                    (u8 * Copy_u8ReceivedData
 u8   USART_u8GetParityError                 (void                                                                          );
 
 u8   USART_u8SendStringSynch                ( u8 * Copy_pu8String                                                          );
+u8   USART_u8SendStringSynch_P              (const u8 * Copy_pu8String                                                     );
+u8   USART_u8SendNumber                     (u32 Copy_u32Number                                                            );
 u8   USART_u8SendStringAsynch               ( u8 * Copy_pu8String , void (* NotificationFunc)(void)                        );
 
 u8   USART_u8ReceiveBufferSynch             (u8 * Copy_pu8String , u32 Copy_u32BufferSize                                  );
 u8   USART_u8ReceiveBufferAsynch            (u8 * Copy_pu8String , u32 Copy_u32BufferSize , void (* NotificationFunc)(void));
 
+u8   USART_u8Available                      (void                                                                          );
+u8   USART_u8GetChar                        (u8 * Copy_pu8Data                                                             );
+u8   USART_u8PeekChar                       (u8 * Copy_pu8Data                                                             );
+
+u8   USART_u8PutChar                        (u8 Copy_u8Data                                                                );
+u8   USART_u8PutString                      (const u8 * Copy_pu8String                                                     );
+u8   USART_u8TxFree                         (void                                                                          );
+void USART_vFlushTx                         (void                                                                          );
+
+void USART_vSetNodeAddress                  (u8 Copy_u8Address                                                             );
+u8   USART_u8SendAddress                    (u8 Copy_u8Address                                                             );
+
+void USART_vGetErrors                       (USART_Errors_t * Copy_pErrors , u8 Copy_u8Clear                               );
+
 #endif /* USART_INTERFACE_H_ */
@@ -52,5 +52,15 @@
 #define UBRRH_URSEL               7
 
 #define UBRRL_MAX                 256
+#define UBRR_MAX                  4095
+
+/*   Baud Rate Divisors (rounded to the nearest value) and the baud rates they give    */
+#define USART_UBRR_1X             (((SYSTEM_FREQUENCY) + (8UL * (USART_BAUD_RATE))) / (16UL * (USART_BAUD_RATE)) - 1UL)
+#define USART_UBRR_2X             (((SYSTEM_FREQUENCY) + (4UL * (USART_BAUD_RATE))) / (8UL * (USART_BAUD_RATE)) - 1UL)
+#define USART_REAL_BAUD_1X        ((SYSTEM_FREQUENCY) / (16UL * (USART_UBRR_1X + 1UL)))
+#define USART_REAL_BAUD_2X        ((SYSTEM_FREQUENCY) / (8UL * (USART_UBRR_2X + 1UL)))
+
+/*   Baud rate error in 0.1 % steps    */
+#define USART_BAUD_ERROR(BAUD)    ((((BAUD) > (USART_BAUD_RATE)) ? ((BAUD) - (USART_BAUD_RATE)) : ((USART_BAUD_RATE) - (BAUD))) * 1000UL / (USART_BAUD_RATE))
 
 #endif
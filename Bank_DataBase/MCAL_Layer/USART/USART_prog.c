@@ -7,19 +7,69 @@
  *
  */
 
+#include <avr/pgmspace.h>
+
 #include "../../APP_Layer/STD_TYPES.h"
 #include "../../APP_Layer/STD_MACROS.h"
 
-#include <util/delay.h>
-
 #include "../../MCAL_Layer/DIO/DIO_interface.h"
+#include "../../MCAL_Layer/GIE/GIE_interface.h"
+#include "../../MCAL_Layer/TIMER/TIMER_interface.h"
+#include "../../MCAL_Layer/FMT/FMT_interface.h"
 
 #include "USART_config.h"
 #include "USART_interface.h"
 #include "USART_private.h"
 
+/*Pick the speed mode and check the baud rate error at compile time*/
+#if USART_MODE == ASYNCHRONOUS
+
+#if (USART_SYSTEM_SPEED == USART_1X) || ((USART_SYSTEM_SPEED == USART_AUTO_SPEED) && \
+    (USART_UBRR_1X <= UBRR_MAX) && (USART_BAUD_ERROR(USART_REAL_BAUD_1X) <= USART_BAUD_ERROR(USART_REAL_BAUD_2X)))
+#define USART_USE_2X              0
+#define USART_UBRR                USART_UBRR_1X
+#define USART_REAL_BAUD           USART_REAL_BAUD_1X
+#elif (USART_SYSTEM_SPEED == USART_2X) || (USART_SYSTEM_SPEED == USART_AUTO_SPEED)
+#define USART_USE_2X              1
+#define USART_UBRR                USART_UBRR_2X
+#define USART_REAL_BAUD           USART_REAL_BAUD_2X
+#else
+#error "Wrong USART_SYSTEM_SPEED config"
+#endif
+
+#if (USART_UBRR > UBRR_MAX) || (USART_BAUD_RATE > ((SYSTEM_FREQUENCY) / 8UL))
+#error "USART_BAUD_RATE can not be reached from SYSTEM_FREQUENCY"
+#endif
+
+#if USART_BAUD_ERROR(USART_REAL_BAUD) > USART_BAUD_ERROR_MAX
+#error "USART_BAUD_RATE error is above USART_BAUD_ERROR_MAX"
+#endif
+
+#endif
+
+#if (USART_RX_BUFFER_SIZE < 2) || (USART_RX_BUFFER_SIZE > 128) || (USART_RX_BUFFER_SIZE & (USART_RX_BUFFER_SIZE - 1))
+#error "Wrong USART_RX_BUFFER_SIZE config"
+#endif
+
+#if (USART_MPCM == ENABLE) && ((USART_DATA_SIZE != DATA_SIZE_9_BIT) || (USART_RX_COMPLETE_INTERRUPT != ENABLE))
+#error "USART_MPCM needs DATA_SIZE_9_BIT and USART_RX_COMPLETE_INTERRUPT"
+#endif
+
+#if (USART_FLOW_CONTROL != USART_FLOW_NONE) && ((USART_RX_COMPLETE_INTERRUPT != ENABLE) || (USART_UDR_EMPTY_INTERRUPT != ENABLE))
+#error "USART_FLOW_CONTROL needs USART_RX_COMPLETE_INTERRUPT and USART_UDR_EMPTY_INTERRUPT"
+#endif
+
+#if (USART_FLOW_CONTROL != USART_FLOW_NONE) && \
+    ((USART_RX_LOW_WATERMARK >= USART_RX_HIGH_WATERMARK) || (USART_RX_HIGH_WATERMARK > USART_RX_BUFFER_SIZE))
+#error "Wrong USART_RX_HIGH_WATERMARK or USART_RX_LOW_WATERMARK config"
+#endif
+
+#if (USART_TX_BUFFER_SIZE < 2) || (USART_TX_BUFFER_SIZE > 128) || (USART_TX_BUFFER_SIZE & (USART_TX_BUFFER_SIZE - 1))
+#error "Wrong USART_TX_BUFFER_SIZE config"
+#endif
+
 /*Global variable to carry the send Data*/
-static const u8 *USART_pu8SendData = NULL;
+static const u8 *volatile USART_pu8SendData = NULL;
 
 /*Global variable to carry the Receive Data*/
 static u8 *USART_pu8ReceiveData = NULL;
@@ -36,6 +86,86 @@ static void (*USART_pvNotificationFunc)(void) = NULL;
 /*Global flag for the USART Busy State*/
 static u8 USART_u8State = IDLE;
 
+/*Ring of received bytes filled by the RX complete ISR*/
+static volatile u8 USART_au8RxBuffer[USART_RX_BUFFER_SIZE];
+
+/*Free running write (ISR) and read (task) counters, each side only moves its own one*/
+static volatile u8 USART_u8RxHead = 0;
+static volatile u8 USART_u8RxTail = 0;
+
+/*Ring of bytes to send drained by the UDR empty ISR*/
+static volatile u8 USART_au8TxBuffer[USART_TX_BUFFER_SIZE];
+
+/*Free running write (task) and read (ISR) counters, each side only moves its own one*/
+static volatile u8 USART_u8TxHead = 0;
+static volatile u8 USART_u8TxTail = 0;
+
+#if USART_UDR_EMPTY_INTERRUPT == ENABLE
+/*Ring position of the USART_u8SendStringAsynch string, the bytes queued before it go first*/
+static volatile u8 USART_u8TxMark;
+
+/*The UDR empty ISR still has to send the USART_u8SendStringAsynch string*/
+#define USART_TX_STRING_PENDING()           (USART_pu8SendData != NULL)
+#else
+#define USART_TX_STRING_PENDING()           0
+#endif
+
+/*Address of this node on a multi-drop bus*/
+static volatile u8 USART_u8NodeAddress = USART_NODE_ADDRESS;
+
+/*Receive errors seen by the RX complete ISR*/
+static volatile USART_Errors_t USART_Errors = {0, 0, 0, 0};
+
+#if USART_FLOW_CONTROL != USART_FLOW_NONE
+/*The host was asked to wait (RX side), the host asked us to wait (TX side)*/
+static volatile u8 USART_u8RxPaused = 0;
+static volatile u8 USART_u8TxPaused = 0;
+#endif
+
+#if USART_FLOW_CONTROL == USART_FLOW_XON_XOFF
+/*XON or XOFF to send ahead of the TX ring buffer, 0 when none*/
+static volatile u8 USART_u8TxControl = 0;
+#endif
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function arms the UDR empty interrupt when the TX ring buffer or an asynch string holds data
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+static void USART_vTxKick(void)
+{
+  /*UDR Empty Interrupt Enable, UCSRB is also changed by the other USART ISRs*/
+  u8 Local_u8SREG = GIE_u8EnterCritical();
+  if ((USART_u8TxHead != USART_u8TxTail) || USART_TX_STRING_PENDING())
+  {
+    SET_BIT(UCSRB, UCSRB_UDRIE);
+  }
+  GIE_vExitCritical(Local_u8SREG);
+}
+
+#if USART_FLOW_CONTROL != USART_FLOW_NONE
+/*
+ * Breif      : This Function asks the host to wait or to go on, called with interrupts disabled
+ * Parameters :
+ *            => Copy_u8Pause : 1 to pause the host, 0 to resume it
+ * return     :  Nothing
+ */
+static void USART_vRxFlow(u8 Copy_u8Pause)
+{
+  USART_u8RxPaused = Copy_u8Pause;
+
+#if USART_FLOW_CONTROL == USART_FLOW_XON_XOFF
+  /*Sent by the UDR empty ISR before any queued byte*/
+  USART_u8TxControl = Copy_u8Pause ? USART_XOFF : USART_XON;
+  SET_BIT(UCSRB, UCSRB_UDRIE);
+#else
+  DIO_enumWritePinVal(USART_RTS_PORT, USART_RTS_PIN, Copy_u8Pause ? DIO_PIN_HIGH : DIO_PIN_LOW);
+#endif
+}
+#endif
+
 /*___________________________________________________________________________________________________________________*/
 
 /*
@@ -49,19 +179,19 @@ void USART_vInit(void)
   u8 Local_u8UCSRC = 0;
 
   /***** Check 3 Modes   *****/
-#if (USART_MODE == ASYNCHRONOUS) && (USART_SYSTEM_SPEED == USART_1X)
+#if (USART_MODE == ASYNCHRONOUS) && (USART_USE_2X == 0)
 
   CLR_BIT(UCSRA, UCSRA_U2X);
 
-  /*Calculate The Baud Rate From The Equation */
-  u16 Local_u16UBRR = (u16)((SYSTEM_FREQUENCY / (16 * USART_BAUD_RATE)) - 1);
+  /*Baud Rate divisor picked at compile time*/
+  u16 Local_u16UBRR = (u16)USART_UBRR;
 
-#elif (USART_MODE == ASYNCHRONOUS) && (USART_SYSTEM_SPEED == USART_2X)
+#elif (USART_MODE == ASYNCHRONOUS) && (USART_USE_2X == 1)
 
   SET_BIT(UCSRA, UCSRA_U2X);
 
-  /*Calculate The Baud Rate From The Equation */
-  u16 Local_u16UBRR = (u16)((SYSTEM_FREQUENCY / (8 * USART_BAUD_RATE)) - 1);
+  /*Baud Rate divisor picked at compile time*/
+  u16 Local_u16UBRR = (u16)USART_UBRR;
 
 #elif (USART_MODE == SYNCHRONOUS)
 
@@ -77,7 +207,7 @@ void USART_vInit(void)
       $ Set Baud Rate
       Hint : UBRRH then UBRRL to avoid problems
    */
-  UBRRH = (u8)(Local_u16UBRR << 8); /* MSBs at Local_u16UBRR */
+  UBRRH = (u8)(Local_u16UBRR >> 8); /* MSBs at Local_u16UBRR */
   UBRRL = (u8)Local_u16UBRR;
   /*___________________________________________________________________________________________________________________*/
 
@@ -85,7 +215,9 @@ void USART_vInit(void)
 #if USART_MPCM == DISABLE
   CLR_BIT(UCSRA, UCSRA_MPCM);
 #elif USART_MPCM == ENABLE
+  /*Ignore data frames until an address frame selects this node, own frames go out as data*/
   SET_BIT(UCSRA, UCSRA_MPCM);
+  CLR_BIT(UCSRB, UCSRB_TXB8);
 #else
 #error "Wrong USART_MPCM config"
 #endif
@@ -228,9 +360,20 @@ void USART_vInit(void)
 #if USART_UDR_EMPTY_INTERRUPT == DISABLE
   CLR_BIT(UCSRB, UCSRB_UDRIE);
 #elif USART_UDR_EMPTY_INTERRUPT == ENABLE
-  SET_BIT(UCSRB, UCSRB_UDRIE);
+  /*Enabled by the TX ring buffer once it holds data*/
+  CLR_BIT(UCSRB, UCSRB_UDRIE);
 #else
 #error "Wrong USART_UDR_EMPTY_INTERRUPT config"
+#endif
+
+  /*Flow Control*/
+#if USART_FLOW_CONTROL == USART_FLOW_RTS_CTS
+  /*RTS low tells the host it may send, CTS is driven by the host*/
+  DIO_enumSetPinDir(USART_RTS_PORT, USART_RTS_PIN, DIO_PIN_OUTPUT);
+  DIO_enumWritePinVal(USART_RTS_PORT, USART_RTS_PIN, DIO_PIN_LOW);
+  DIO_enumSetPinDir(USART_CTS_PORT, USART_CTS_PIN, DIO_PIN_INPUT);
+#elif (USART_FLOW_CONTROL != USART_FLOW_NONE) && (USART_FLOW_CONTROL != USART_FLOW_XON_XOFF)
+#error "Wrong USART_FLOW_CONTROL config"
 #endif
 
   /*Receive Enable*/
@@ -277,8 +420,17 @@ void USART_vInit(void)
 u8 USART_u8SendData(u8 Copy_u8Data)
 {
   u8 Local_u8ErrorState = OK;
-  u32 Local_u32TimeoutCounter = 0;
+  u32 Local_u32Deadline = TIMER_u32Deadline(USART_u16TIMEOUT_MS);
 
+#if USART_UDR_EMPTY_INTERRUPT == ENABLE
+  /*Queue behind the bytes already waiting so the output keeps its order*/
+  while (((Local_u8ErrorState = USART_u8PutChar(Copy_u8Data)) == BUSY_STATE) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
+
+  if (Local_u8ErrorState != OK)
+  {
+    Local_u8ErrorState = TIMEOUT_STATE;
+  }
+#else
   if (USART_u8State == IDLE)
   {
     USART_u8State = BUSY;
@@ -287,12 +439,9 @@ u8 USART_u8SendData(u8 Copy_u8Data)
       Hint : TIMEOUT to avoid infinity loop
      */
     /*Wait until a Receiving complete or Timing out*/
-    while (((READ_BIT(UCSRA, UCSRA_UDRE)) == 0) && (Local_u32TimeoutCounter != USART_u32TIMEOUT))
-    {
-      Local_u32TimeoutCounter++;
-    }
+    while (((READ_BIT(UCSRA, UCSRA_UDRE)) == 0) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
 
-    if (Local_u32TimeoutCounter == USART_u32TIMEOUT)
+    if ((READ_BIT(UCSRA, UCSRA_UDRE)) == 0)
     {
       Local_u8ErrorState = TIMEOUT_STATE;
     }
@@ -307,6 +456,7 @@ u8 USART_u8SendData(u8 Copy_u8Data)
   {
     Local_u8ErrorState = BUSY_STATE;
   }
+#endif
 
   return Local_u8ErrorState;
 }
@@ -324,21 +474,27 @@ u8 USART_u8SendData(u8 Copy_u8Data)
 u8 USART_u8ReceiveData(u8 *Copy_u8ReceivedData)
 {
   u8 Local_u8ErrorState = OK;
-  u32 Local_u32TimeoutCounter = 0;
+  u32 Local_u32Deadline = TIMER_u32Deadline(USART_u16TIMEOUT_MS);
 
   if (Copy_u8ReceivedData != NULL)
   {
+#if USART_RX_COMPLETE_INTERRUPT == ENABLE
+    /*Wait until the RX complete ISR buffers a byte*/
+    while (((Local_u8ErrorState = USART_u8GetChar(Copy_u8ReceivedData)) == NOK) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
+
+    if (Local_u8ErrorState != OK)
+    {
+      Local_u8ErrorState = TIMEOUT_STATE;
+    }
+#else
     if (USART_u8State == IDLE)
     {
       USART_u8State = BUSY;
 
       /*Wait until a receive complete*/
-      while (((READ_BIT(UCSRA, UCSRA_RXC)) == 0) && (Local_u32TimeoutCounter != USART_u32TIMEOUT))
-      {
-        Local_u32TimeoutCounter++;
-      }
+      while (((READ_BIT(UCSRA, UCSRA_RXC)) == 0) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
 
-      if (Local_u32TimeoutCounter == USART_u32TIMEOUT)
+      if ((READ_BIT(UCSRA, UCSRA_RXC)) == 0)
       {
         Local_u8ErrorState = TIMEOUT_STATE;
       }
@@ -353,6 +509,7 @@ u8 USART_u8ReceiveData(u8 *Copy_u8ReceivedData)
     {
       Local_u8ErrorState = BUSY_STATE;
     }
+#endif
   }
   else
   {
@@ -382,7 +539,6 @@ u8 USART_u8SendStringSynch(u8 *Copy_pu8String)
     while (Copy_pu8String[Local_u32Index] != '\0')
     {
       Local_u8ErrorState = USART_u8SendData(Copy_pu8String[Local_u32Index]);
-      _delay_ms(100);
       Local_u32Index++;
       if (Local_u8ErrorState != OK)
       {
@@ -400,13 +556,73 @@ u8 USART_u8SendStringSynch(u8 *Copy_pu8String)
 
 /*___________________________________________________________________________________________________________________*/
 
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      A function to send a string stored in flash (PROGMEM) (polling)
+ *                                                *--------------------------------------------------*
+ * Parameters :
+ *		Copy_pu8String => flash address of the string
+ *
+ * return     : Error status with type u8
+ */
+u8 USART_u8SendStringSynch_P(const u8 *Copy_pu8String)
+{
+  u8 Local_u8ErrorState = OK;
+  u8 Local_u8Data;
+
+  if (Copy_pu8String != NULL)
+  {
+    Local_u8Data = pgm_read_byte(Copy_pu8String);
+    while (Local_u8Data != '\0')
+    {
+      Local_u8ErrorState = USART_u8SendData(Local_u8Data);
+      if (Local_u8ErrorState != OK)
+      {
+        break;
+      }
+      Copy_pu8String++;
+      Local_u8Data = pgm_read_byte(Copy_pu8String);
+    }
+  }
+  else
+  {
+    Local_u8ErrorState = NULL_POINTER;
+  }
+
+  return Local_u8ErrorState;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*------------------------------------------------------------------------------------------------------------------------------------------------------
+ *         	                                      A function to send an unsigned number in decimal (polling)
+ *                                                *--------------------------------------------------*
+ * Parameters :
+ *		Copy_u32Number => number to send
+ *
+ * return     : Error status with type u8
+ */
+u8 USART_u8SendNumber(u32 Copy_u32Number)
+{
+  u8 Local_au8Digits[FMT_BUFFER_SIZE];
+
+  FMT_u8Unsigned(Copy_u32Number, 0, FMT_PAD_SPACE, Local_au8Digits);
+
+  return USART_u8SendStringSynch(Local_au8Digits);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
 /*------------------------------------------------------------------------------------------------------------------------------------------------------
  *         	                                      A function to send string from Tx to Rx (Interrupt)
  *                                               *----------------------------------------------------*
  * Parameters :
- *		Copy_pu8String   => pointer that holds the data
+ *		Copy_pu8String   => pointer that holds the data, read while it is sent so it must stay valid
  *      NotificationFunc => function that called after the transmit complete
  *
+ * With the UDR empty interrupt the string is sent by that ISR in its place in the TX ring buffer
+ * (after the bytes already queued, before the ones queued later, held by the flow control as well),
+ * the notification comes once its last byte is handed to UDR.
+ *
  * return     : Error status with type u8
  */
 u8 USART_u8SendStringAsynch(u8 *Copy_pu8String, void (*NotificationFunc)(void))
@@ -417,6 +633,23 @@ u8 USART_u8SendStringAsynch(u8 *Copy_pu8String, void (*NotificationFunc)(void))
   {
     if ((Copy_pu8String != NULL) && (NotificationFunc != NULL))
     {
+#if USART_UDR_EMPTY_INTERRUPT == ENABLE
+      /*USART is now Busy*/
+      USART_u8State = BUSY;
+
+      /*Assign the USART data globally, the string last as the UDR empty ISR may already be enabled*/
+      USART_pvNotificationFunc = NotificationFunc;
+      USART_u8TxMark = USART_u8TxHead;
+      USART_pu8SendData = Copy_pu8String;
+
+      USART_vTxKick();
+#else
+      if ((READ_BIT(UCSRA, UCSRA_UDRE)) == 0)
+      {
+        /*A byte of USART_u8SendData still waits in UDR*/
+        return BUSY_STATE;
+      }
+
       /*USART is now Busy*/
       USART_u8State = BUSY;
 
@@ -432,6 +665,7 @@ u8 USART_u8SendStringAsynch(u8 *Copy_pu8String, void (*NotificationFunc)(void))
 
       /*USART Transmit Interrupt Enable*/
       SET_BIT(UCSRB, UCSRB_TXCIE);
+#endif
     }
     else
     {
@@ -503,14 +737,15 @@ u8 USART_u8ReceiveBufferAsynch(u8 *Copy_pu8String, u32 Copy_u32BufferSize, void
       /*USART is now Busy*/
       USART_u8State = BUSY;
 
-      /*Assign the USART data globally*/
-      USART_pu8ReceiveData = Copy_pu8String;
+      /*Assign the USART data globally, the buffer last as the RX ISR may already be enabled*/
       USART_pvNotificationFunc = NotificationFunc;
       USART_u8BufferSize = Copy_u32BufferSize;
 
       /*Set Index to first element*/
       USART_u8Index = 0;
 
+      USART_pu8ReceiveData = Copy_pu8String;
+
       /*USART Recieve Interrupt Enable */
       SET_BIT(UCSRB, UCSRB_RXCIE);
     }
@@ -529,12 +764,340 @@ u8 USART_u8ReceiveBufferAsynch(u8 *Copy_pu8String, u32 Copy_u32BufferSize, void
 
 /*___________________________________________________________________________________________________________________*/
 
+/*
+ * Breif      : This Function returns the number of received bytes waiting in the RX ring buffer
+ * Parameters :  Nothing
+ * return     :  number of buffered bytes
+ */
+u8 USART_u8Available(void)
+{
+  return (u8)(USART_u8RxHead - USART_u8RxTail);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function takes the oldest received byte from the RX ring buffer without waiting
+ * Parameters :
+ *            => Copy_pu8Data : pointer to carry the byte
+ * return     :  Error status (OK, NOK if the buffer is empty, NULL_POINTER)
+ */
+u8 USART_u8GetChar(u8 *Copy_pu8Data)
+{
+  u8 Local_u8ErrorState = USART_u8PeekChar(Copy_pu8Data);
+
+  if (Local_u8ErrorState == OK)
+  {
+    /*Release the slot only after reading it, the ISR may refill it right away*/
+    USART_u8RxTail++;
+
+#if USART_FLOW_CONTROL != USART_FLOW_NONE
+    /*Let the host go on once the ring has drained enough*/
+    if (USART_u8RxPaused && ((u8)(USART_u8RxHead - USART_u8RxTail) <= USART_RX_LOW_WATERMARK))
+    {
+      u8 Local_u8SREG = GIE_u8EnterCritical();
+      USART_vRxFlow(0);
+      GIE_vExitCritical(Local_u8SREG);
+    }
+#endif
+  }
+
+  return Local_u8ErrorState;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function reads the oldest received byte from the RX ring buffer and leaves it there
+ * Parameters :
+ *            => Copy_pu8Data : pointer to carry the byte
+ * return     :  Error status (OK, NOK if the buffer is empty, NULL_POINTER)
+ */
+u8 USART_u8PeekChar(u8 *Copy_pu8Data)
+{
+  u8 Local_u8ErrorState = OK;
+
+#if USART_FLOW_CONTROL == USART_FLOW_RTS_CTS
+  /*Polled by the main loop, so a transmitter held by CTS starts again here*/
+  if (USART_u8TxPaused)
+  {
+    USART_vTxKick();
+  }
+#endif
+
+  if (Copy_pu8Data == NULL)
+  {
+    Local_u8ErrorState = NULL_POINTER;
+  }
+  else if (USART_u8RxHead == USART_u8RxTail)
+  {
+    Local_u8ErrorState = NOK;
+  }
+  else
+  {
+    *Copy_pu8Data = USART_au8RxBuffer[USART_u8RxTail & (USART_RX_BUFFER_SIZE - 1)];
+  }
+
+  return Local_u8ErrorState;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function queues one byte in the TX ring buffer and returns at once
+ * Parameters :
+ *            => Copy_u8Data : byte to send
+ * return     :  Error status (OK, BUSY_STATE if the buffer is full)
+ */
+u8 USART_u8PutChar(u8 Copy_u8Data)
+{
+  if ((u8)(USART_u8TxHead - USART_u8TxTail) >= USART_TX_BUFFER_SIZE)
+  {
+    return BUSY_STATE;
+  }
+
+  USART_au8TxBuffer[USART_u8TxHead & (USART_TX_BUFFER_SIZE - 1)] = Copy_u8Data;
+  USART_u8TxHead++;
+
+  USART_vTxKick();
+
+  return OK;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function queues a whole string in the TX ring buffer and returns at once
+ * Parameters :
+ *            => Copy_pu8String : null terminated string
+ * return     :  Error status (OK, NULL_POINTER, BUSY_STATE if it does not fit, nothing is queued then)
+ */
+u8 USART_u8PutString(const u8 *Copy_pu8String)
+{
+  u16 Local_u16Length = 0;
+
+  if (Copy_pu8String == NULL)
+  {
+    return NULL_POINTER;
+  }
+
+  while (Copy_pu8String[Local_u16Length] != '\0')
+  {
+    Local_u16Length++;
+  }
+
+  if (Local_u16Length > USART_u8TxFree())
+  {
+    return BUSY_STATE;
+  }
+
+  for (u16 Local_u16Index = 0; Local_u16Index < Local_u16Length; Local_u16Index++)
+  {
+    USART_u8PutChar(Copy_pu8String[Local_u16Index]);
+  }
+
+  return OK;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function returns the number of free bytes in the TX ring buffer
+ * Parameters :  Nothing
+ * return     :  number of bytes that can be queued without waiting
+ */
+u8 USART_u8TxFree(void)
+{
+  return USART_TX_BUFFER_SIZE - (u8)(USART_u8TxHead - USART_u8TxTail);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function waits until every queued byte and the asynch string have been handed to the transmitter
+ * Parameters :  Nothing
+ * return     :  Nothing
+ */
+void USART_vFlushTx(void)
+{
+  while ((USART_u8TxHead != USART_u8TxTail) || USART_TX_STRING_PENDING())
+  {
+#if USART_FLOW_CONTROL == USART_FLOW_RTS_CTS
+    /*CTS is not an interrupt, look at it again*/
+    USART_vTxKick();
+#endif
+  }
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sets the address this node answers to in multi-processor communication mode
+ * Parameters :
+ *            => Copy_u8Address : node address
+ * return     :  Nothing
+ */
+void USART_vSetNodeAddress(u8 Copy_u8Address)
+{
+  USART_u8NodeAddress = Copy_u8Address;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function sends an address frame (9th bit set) to select a node on a multi-drop bus
+ *              queued bytes are sent first since the 9th bit is shared by every frame
+ * Parameters :
+ *            => Copy_u8Address : address of the node to select
+ * return     :  Error status (OK, TIMEOUT_STATE)
+ */
+u8 USART_u8SendAddress(u8 Copy_u8Address)
+{
+  u8 Local_u8ErrorState = OK;
+  u32 Local_u32Deadline;
+
+#if USART_UDR_EMPTY_INTERRUPT == ENABLE
+  USART_vFlushTx();
+#endif
+
+  Local_u32Deadline = TIMER_u32Deadline(USART_u16TIMEOUT_MS);
+  while (((READ_BIT(UCSRA, UCSRA_UDRE)) == 0) && (TIMER_u8IsExpired(Local_u32Deadline) == 0));
+
+  if ((READ_BIT(UCSRA, UCSRA_UDRE)) == 0)
+  {
+    Local_u8ErrorState = TIMEOUT_STATE;
+  }
+  else
+  {
+    SET_BIT(UCSRB, UCSRB_TXB8);
+    UDR = Copy_u8Address;
+    /*TXB8 is copied into the shift register with UDR, the next frames are data again*/
+    while ((READ_BIT(UCSRA, UCSRA_UDRE)) == 0);
+    CLR_BIT(UCSRB, UCSRB_TXB8);
+  }
+
+  return Local_u8ErrorState;
+}
+
+/*___________________________________________________________________________________________________________________*/
+
+/*
+ * Breif      : This Function copies the receive error counters of the RX complete ISR
+ * Parameters :
+ *            => Copy_pErrors : pointer to carry the counters
+ *            => Copy_u8Clear : 1 to restart counting from zero
+ * return     :  Nothing
+ */
+void USART_vGetErrors(USART_Errors_t *Copy_pErrors, u8 Copy_u8Clear)
+{
+  u8 Local_u8SREG = GIE_u8EnterCritical();
+
+  if (Copy_pErrors != NULL)
+  {
+    Copy_pErrors->Frame = USART_Errors.Frame;
+    Copy_pErrors->Overrun = USART_Errors.Overrun;
+    Copy_pErrors->Parity = USART_Errors.Parity;
+    Copy_pErrors->Dropped = USART_Errors.Dropped;
+  }
+
+  if (Copy_u8Clear)
+  {
+    USART_Errors.Frame = 0;
+    USART_Errors.Overrun = 0;
+    USART_Errors.Parity = 0;
+    USART_Errors.Dropped = 0;
+  }
+
+  GIE_vExitCritical(Local_u8SREG);
+}
+
+/*___________________________________________________________________________________________________________________*/
+
 /* ISR for RX complete */
 void __vector_13(void) __attribute__((signal));
 void __vector_13(void)
 {
+  /*The error flags belong to the byte in UDR, read them first*/
+  u8 Local_u8Status = UCSRA;
+
+#if USART_MPCM == ENABLE
+  /*The 9th bit has to be read before UDR*/
+  u8 Local_u8AddressFrame = READ_BIT(UCSRB, UCSRB_RXB8);
+#endif
+
+  /*Reading UDR clears the flag, it must be read even if the byte is dropped*/
+  u8 Local_u8Data = UDR;
+
+  if (READ_BIT(Local_u8Status, UCSRA_FE))
+  {
+    USART_Errors.Frame++;
+  }
+  if (READ_BIT(Local_u8Status, UCSRA_DOR))
+  {
+    USART_Errors.Overrun++;
+  }
+  if (READ_BIT(Local_u8Status, UCSRA_PE))
+  {
+    USART_Errors.Parity++;
+  }
+
+#if USART_MPCM == ENABLE
+  if (Local_u8AddressFrame)
+  {
+    /*Listen to the data frames that follow only when this node is selected,
+      otherwise the hardware drops them without an interrupt*/
+    if ((Local_u8Data == USART_u8NodeAddress) || (Local_u8Data == USART_BROADCAST_ADDRESS))
+    {
+      CLR_BIT(UCSRA, UCSRA_MPCM);
+    }
+    else
+    {
+      SET_BIT(UCSRA, UCSRA_MPCM);
+    }
+    return;
+  }
+#endif
+
+#if USART_FLOW_CONTROL == USART_FLOW_XON_XOFF
+  /*Flow control from the host is not input*/
+  if (Local_u8Data == USART_XOFF)
+  {
+    USART_u8TxPaused = 1;
+    return;
+  }
+  if (Local_u8Data == USART_XON)
+  {
+    USART_u8TxPaused = 0;
+    SET_BIT(UCSRB, UCSRB_UDRIE);
+    return;
+  }
+#endif
+
+  if (USART_pu8ReceiveData == NULL)
+  {
+    /*No buffer receive in progress, keep the byte in the ring (dropped if the ring is full)*/
+    if ((u8)(USART_u8RxHead - USART_u8RxTail) < USART_RX_BUFFER_SIZE)
+    {
+      USART_au8RxBuffer[USART_u8RxHead & (USART_RX_BUFFER_SIZE - 1)] = Local_u8Data;
+      USART_u8RxHead++;
+    }
+    else
+    {
+      USART_Errors.Dropped++;
+    }
+
+#if USART_FLOW_CONTROL != USART_FLOW_NONE
+    /*Ask the host to wait while there is still room for the bytes already on the way*/
+    if ((USART_u8RxPaused == 0) && ((u8)(USART_u8RxHead - USART_u8RxTail) >= USART_RX_HIGH_WATERMARK))
+    {
+      USART_vRxFlow(1);
+    }
+#endif
+    return;
+  }
+
   /*Receive next Data*/
-  USART_pu8ReceiveData[USART_u8Index] = UDR;
+  USART_pu8ReceiveData[USART_u8Index] = Local_u8Data;
 
   /*Increment Data index of the buffer*/
   USART_u8Index++;
@@ -544,6 +1107,7 @@ void __vector_13(void)
     /*Send Data Complete*/
 
     USART_u8Index = 0;
+    USART_pu8ReceiveData = NULL;
     /*USART is now IDLE*/
     USART_u8State = IDLE;
 
@@ -553,8 +1117,10 @@ void __vector_13(void)
       USART_pvNotificationFunc();
     }
 
+#if USART_RX_COMPLETE_INTERRUPT == DISABLE
     /*USART Recieve Interrupt Disable*/
     CLR_BIT(UCSRB, UCSRB_RXCIE);
+#endif
   }
   else
   {
@@ -562,11 +1128,81 @@ void __vector_13(void)
   }
 }
 
+//-------------------------------------------------------------------------------------------------------------------------------
+/* ISR for UDR empty */
+void __vector_14(void) __attribute__((signal));
+void __vector_14(void)
+{
+#if USART_FLOW_CONTROL == USART_FLOW_XON_XOFF
+  if (USART_u8TxControl != 0)
+  {
+    /*XON/XOFF goes out even while the host holds us*/
+    UDR = USART_u8TxControl;
+    USART_u8TxControl = 0;
+    return;
+  }
+#elif USART_FLOW_CONTROL == USART_FLOW_RTS_CTS
+  u8 Local_u8Cts = DIO_PIN_LOW;
+  DIO_enumReadPinVal(USART_CTS_PORT, USART_CTS_PIN, &Local_u8Cts);
+  USART_u8TxPaused = (Local_u8Cts == DIO_PIN_HIGH);
+#endif
+
+#if USART_FLOW_CONTROL != USART_FLOW_NONE
+  if (USART_u8TxPaused)
+  {
+    /*Queued bytes wait, XON or USART_vTxKick arms the interrupt again*/
+    CLR_BIT(UCSRB, UCSRB_UDRIE);
+    return;
+  }
+#endif
+
+#if USART_UDR_EMPTY_INTERRUPT == ENABLE
+  if (USART_TX_STRING_PENDING() && (USART_u8TxTail == USART_u8TxMark))
+  {
+    /*The bytes queued before the asynch string are out, send the string*/
+    if (*USART_pu8SendData != '\0')
+    {
+      UDR = *USART_pu8SendData;
+      USART_pu8SendData++;
+    }
+
+    if (*USART_pu8SendData == '\0')
+    {
+      /*Send Data Complete*/
+      USART_pu8SendData = NULL;
+
+      /*USART is now IDLE*/
+      USART_u8State = IDLE;
+
+      /*Call Notification Function*/
+      if (USART_pvNotificationFunc != NULL)
+      {
+        USART_pvNotificationFunc();
+      }
+    }
+  }
+  else
+#endif
+  if (USART_u8TxHead != USART_u8TxTail)
+  {
+    /*Send next queued Data*/
+    UDR = USART_au8TxBuffer[USART_u8TxTail & (USART_TX_BUFFER_SIZE - 1)];
+    USART_u8TxTail++;
+  }
+
+  if ((USART_u8TxHead == USART_u8TxTail) && !USART_TX_STRING_PENDING())
+  {
+    /*Nothing left to send, UDR Empty Interrupt Disable*/
+    CLR_BIT(UCSRB, UCSRB_UDRIE);
+  }
+}
+
 //-------------------------------------------------------------------------------------------------------------------------------
 /* ISR for TX complete */
 void __vector_15(void) __attribute__((signal));
 void __vector_15(void)
 {
+#if USART_UDR_EMPTY_INTERRUPT == DISABLE
 
   /*Increment Data index of the buffer*/
   USART_u8Index++;
@@ -594,4 +1230,5 @@ void __vector_15(void)
     /Send next Data*/
     UDR = USART_pu8SendData[USART_u8Index];
   }
+#endif
 }
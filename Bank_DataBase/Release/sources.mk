@@ -22,10 +22,18 @@ C_DEPS :=
 # Every subdirectory with source files must be described here
 SUBDIRS := \
 APP_Layer \
+APP_Layer/BENCH \
+APP_Layer/CRC \
+APP_Layer/HOST \
+APP_Layer/LINE \
+APP_Layer/MSG \
 APP_Layer/SECURITY \
 HAL_Layer/CLCD \
 HAL_Layer/KPD \
 MCAL_Layer/DIO \
 MCAL_Layer/EEPROM \
+MCAL_Layer/FMT \
+MCAL_Layer/GIE \
+MCAL_Layer/TIMER \
 MCAL_Layer/USART \
 